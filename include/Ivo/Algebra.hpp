@@ -21,10 +21,17 @@
 // Matrices.
 #include "./Algebra/Matrix.hpp"
 #include "./Algebra/Methods/Matrix.hpp"
+#include "./Algebra/Methods/Factorizations.hpp"
+
+// Fixed-size vectors and matrices.
+#include "./Algebra/Fixed.hpp"
 
 // Sparse matrices.
 #include "./Algebra/Sparse.hpp"
 
+// Implicit Kronecker products.
+#include "./Algebra/Kronecker.hpp"
+
 // Solvers.
 #include "./Algebra/Methods/Solvers.hpp"
 
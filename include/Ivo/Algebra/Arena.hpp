@@ -0,0 +1,243 @@
+/**
+ * @file Arena.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Per-thread arena for Vector and Matrix temporaries.
+ * @date 2024-11-01
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef ALGEBRA_ARENA
+#define ALGEBRA_ARENA
+
+#include "./Includes.hpp"
+
+namespace ivo {
+
+    namespace internal {
+
+        /**
+         * @brief Allocation counters.
+         * 
+         */
+        struct Allocations {
+
+            /**
+             * @brief Heap allocations.
+             * 
+             */
+            std::atomic<Natural> heap = 0;
+
+            /**
+             * @brief Arena allocations.
+             * 
+             */
+            std::atomic<Natural> arena = 0;
+        };
+
+        /**
+         * @brief Global allocation counters.
+         * 
+         * @return Allocations& 
+         */
+        inline Allocations &allocations() {
+            static Allocations counters;
+            return counters;
+        }
+
+        /**
+         * @brief Counted heap resource.
+         * 
+         */
+        class Heap: public std::pmr::memory_resource {
+
+            private:
+
+                void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+                    allocations().heap.fetch_add(1, std::memory_order_relaxed);
+                    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+                }
+
+                void do_deallocate(void *pointer, std::size_t bytes, std::size_t alignment) override {
+                    std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+                }
+
+                bool do_is_equal(const std::pmr::memory_resource &resource) const noexcept override {
+                    return this == &resource;
+                }
+        };
+
+        /**
+         * @brief Bump allocator, memory is released by rewinding.
+         * Chunks are kept and reused after rewinding.
+         * 
+         */
+        class Arena: public std::pmr::memory_resource {
+
+            private:
+
+                // Attributes.
+
+                /**
+                 * @brief Chunks.
+                 * 
+                 */
+                std::vector<std::unique_ptr<std::byte[]>> _chunks;
+
+                /**
+                 * @brief Chunks' sizes.
+                 * 
+                 */
+                std::vector<Natural> _sizes;
+
+                /**
+                 * @brief Current chunk.
+                 * 
+                 */
+                Natural _chunk = 0;
+
+                /**
+                 * @brief Current chunk's offset.
+                 * 
+                 */
+                Natural _offset = 0;
+
+            public:
+
+                // Marks.
+
+                /**
+                 * @brief Current position.
+                 * 
+                 * @return std::array<Natural, 2> 
+                 */
+                inline std::array<Natural, 2> mark() const { return {this->_chunk, this->_offset}; }
+
+                /**
+                 * @brief Releases everything allocated after a mark.
+                 * 
+                 * @param mark Mark.
+                 */
+                inline void rewind(const std::array<Natural, 2> &mark) {
+                    this->_chunk = mark[0];
+                    this->_offset = mark[1];
+                }
+
+            private:
+
+                void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+                    allocations().arena.fetch_add(1, std::memory_order_relaxed);
+
+                    for(; this->_chunk < this->_chunks.size(); ++this->_chunk, this->_offset = 0) {
+                        const Natural address = reinterpret_cast<Natural>(this->_chunks[this->_chunk].get()) + this->_offset;
+                        const Natural padding = (alignment - address % alignment) % alignment;
+
+                        if(this->_offset + padding + bytes <= this->_sizes[this->_chunk]) {
+                            this->_offset += padding + bytes;
+                            return reinterpret_cast<void *>(address + padding);
+                        }
+                    }
+
+                    // New chunk.
+                    const Natural size = std::max(constants::arena_chunk, bytes + alignment);
+
+                    this->_chunks.emplace_back(new std::byte[size]);
+                    this->_sizes.emplace_back(size);
+                    this->_offset = 0;
+
+                    return this->do_allocate(bytes, alignment);
+                }
+
+                void do_deallocate(void *, std::size_t, std::size_t) override {}
+
+                bool do_is_equal(const std::pmr::memory_resource &resource) const noexcept override {
+                    return this == &resource;
+                }
+        };
+
+        /**
+         * @brief Counted heap resource.
+         * 
+         * @return Heap* 
+         */
+        inline Heap *heap() {
+            static Heap resource;
+            return &resource;
+        }
+
+        /**
+         * @brief Thread's arena.
+         * 
+         * @return Arena* 
+         */
+        inline Arena *arena() {
+            thread_local Arena resource;
+            return &resource;
+        }
+
+        /**
+         * @brief Thread's current resource for Vector and Matrix entries.
+         * 
+         * @return std::pmr::memory_resource*& 
+         */
+        inline std::pmr::memory_resource *&resource() {
+            thread_local std::pmr::memory_resource *current = heap();
+            return current;
+        }
+
+        /**
+         * @brief Arena scope.
+         * Vectors and matrices constructed within the scope live in the thread's arena
+         * and must not outlive it. Scopes nest.
+         * 
+         */
+        class Scope {
+
+            private:
+
+                // Attributes.
+
+                /**
+                 * @brief Previous resource.
+                 * 
+                 */
+                std::pmr::memory_resource *_previous;
+
+                /**
+                 * @brief Arena's mark.
+                 * 
+                 */
+                std::array<Natural, 2> _mark;
+
+            public:
+
+                // Constructors.
+
+                /**
+                 * @brief Constructs a new Scope object.
+                 * 
+                 * @param target Scope's resource, heap() for long-lived objects within an arena scope.
+                 */
+                Scope(std::pmr::memory_resource *target = arena()): _previous{resource()}, _mark{arena()->mark()} {
+                    resource() = target;
+                }
+
+                /**
+                 * @brief Destroys the Scope object, rewinds the arena.
+                 * 
+                 */
+                ~Scope() {
+                    arena()->rewind(this->_mark);
+                    resource() = this->_previous;
+                }
+
+                Scope(const Scope &) = delete;
+                Scope &operator =(const Scope &) = delete;
+        };
+
+    }
+
+}
+
+#endif
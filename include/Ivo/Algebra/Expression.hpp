@@ -0,0 +1,539 @@
+/**
+ * @file Expression.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Lazy vector expressions.
+ * @date 2024-10-28
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef ALGEBRA_EXPRESSION
+#define ALGEBRA_EXPRESSION
+
+#include "./Arena.hpp"
+
+namespace ivo {
+
+    template<Numerical T, Natural N = 0>
+    class Vector;
+
+    namespace internal {
+
+        // Concepts.
+
+        /**
+         * @brief Lazy expressions' base.
+         * 
+         */
+        struct Lazy {};
+
+        /**
+         * @brief Lazy expressions.
+         * 
+         * @tparam E 
+         */
+        template<typename E>
+        concept Expression = std::derived_from<E, Lazy>;
+
+        /**
+         * @brief Vector check.
+         * 
+         * @tparam E 
+         */
+        template<typename E>
+        struct is_vector: std::false_type {};
+
+        template<Numerical T>
+        struct is_vector<Vector<T>>: std::true_type {};
+
+        /**
+         * @brief Expressions' operands, vectors or lazy expressions.
+         * 
+         * @tparam E 
+         */
+        template<typename E>
+        concept Operand = Expression<E> || is_vector<E>::value;
+
+        // Operations.
+
+        /**
+         * @brief Absolute value.
+         * 
+         */
+        struct Absolute {
+            template<typename T>
+            inline T operator ()(const T &x) const { return std::abs(x); }
+        };
+
+        // Nodes.
+
+        /**
+         * @brief Vector leaf, no copy.
+         * 
+         * @tparam T Numerical type.
+         */
+        template<Numerical T>
+        class Leaf: public Lazy {
+
+            private:
+
+                /**
+                 * @brief Vector's entries.
+                 * 
+                 */
+                const T *_entries;
+
+                /**
+                 * @brief Vector's size.
+                 * 
+                 */
+                Natural _size;
+
+            public:
+
+                // Numerical type.
+
+                using value_type = T;
+
+                // Constructors.
+
+                /**
+                 * @brief Constructs a new Leaf object.
+                 * 
+                 * @param vector Vector.
+                 */
+                Leaf(const Vector<T> &vector): _entries{vector.data().data()}, _size{vector.size()} {}
+
+                // Access.
+
+                /**
+                 * @brief Expression's size.
+                 * 
+                 * @return Natural 
+                 */
+                inline Natural size() const { return this->_size; }
+
+                /**
+                 * @brief Expression's j-th entry.
+                 * 
+                 * @param j Index.
+                 * @return value_type 
+                 */
+                inline T operator ()(const Natural &j) const { return this->_entries[j]; }
+        };
+
+        /**
+         * @brief Stored operand, leaves for vectors.
+         * 
+         * @tparam E 
+         */
+        template<Operand E>
+        struct node { using type = E; };
+
+        template<Numerical T>
+        struct node<Vector<T>> { using type = Leaf<T>; };
+
+        template<Operand E>
+        using Node = typename node<E>::type;
+
+        /**
+         * @brief Operands' numerical type.
+         * 
+         * @tparam E 
+         */
+        template<Operand E>
+        using Scalar = typename Node<E>::value_type;
+
+        /**
+         * @brief Unary expression, op(e).
+         * 
+         * @tparam E Operand.
+         * @tparam Operation Operation.
+         */
+        template<Operand E, typename Operation>
+        class Unary: public Lazy {
+
+            private:
+
+                /**
+                 * @brief Operand.
+                 * 
+                 */
+                Node<E> _operand;
+
+            public:
+
+                // Numerical type.
+
+                using value_type = Scalar<E>;
+
+                // Constructors.
+
+                /**
+                 * @brief Constructs a new Unary object.
+                 * 
+                 * @param operand Operand.
+                 */
+                Unary(const E &operand): _operand{operand} {}
+
+                // Access.
+
+                /**
+                 * @brief Expression's size.
+                 * 
+                 * @return Natural 
+                 */
+                inline Natural size() const { return this->_operand.size(); }
+
+                /**
+                 * @brief Expression's j-th entry.
+                 * 
+                 * @param j Index.
+                 * @return value_type 
+                 */
+                inline value_type operator ()(const Natural &j) const { return Operation{}(this->_operand(j)); }
+        };
+
+        /**
+         * @brief Binary expression, op(l, r).
+         * 
+         * @tparam L Left operand.
+         * @tparam R Right operand.
+         * @tparam Operation Operation.
+         */
+        template<Operand L, Operand R, typename Operation>
+        class Binary: public Lazy {
+
+            private:
+
+                /**
+                 * @brief Left operand.
+                 * 
+                 */
+                Node<L> _left;
+
+                /**
+                 * @brief Right operand.
+                 * 
+                 */
+                Node<R> _right;
+
+            public:
+
+                // Numerical type.
+
+                using value_type = Scalar<L>;
+
+                // Constructors.
+
+                /**
+                 * @brief Constructs a new Binary object.
+                 * 
+                 * @param left Left operand.
+                 * @param right Right operand.
+                 */
+                Binary(const L &left, const R &right): _left{left}, _right{right} {
+                    #ifndef NDEBUG // Integrity check.
+                    assert(left.size() == right.size());
+                    #endif
+                }
+
+                // Access.
+
+                /**
+                 * @brief Expression's size.
+                 * 
+                 * @return Natural 
+                 */
+                inline Natural size() const { return this->_left.size(); }
+
+                /**
+                 * @brief Expression's j-th entry.
+                 * 
+                 * @param j Index.
+                 * @return value_type 
+                 */
+                inline value_type operator ()(const Natural &j) const { return Operation{}(this->_left(j), this->_right(j)); }
+        };
+
+        /**
+         * @brief Scalar-left expression, op(s, r).
+         * 
+         * @tparam R Right operand.
+         * @tparam Operation Operation.
+         */
+        template<Operand R, typename Operation>
+        class Left: public Lazy {
+
+            private:
+
+                /**
+                 * @brief Scalar.
+                 * 
+                 */
+                Scalar<R> _scalar;
+
+                /**
+                 * @brief Right operand.
+                 * 
+                 */
+                Node<R> _right;
+
+            public:
+
+                // Numerical type.
+
+                using value_type = Scalar<R>;
+
+                // Constructors.
+
+                /**
+                 * @brief Constructs a new Left object.
+                 * 
+                 * @param scalar Scalar.
+                 * @param right Right operand.
+                 */
+                Left(const value_type &scalar, const R &right): _scalar{scalar}, _right{right} {}
+
+                // Access.
+
+                /**
+                 * @brief Expression's size.
+                 * 
+                 * @return Natural 
+                 */
+                inline Natural size() const { return this->_right.size(); }
+
+                /**
+                 * @brief Expression's j-th entry.
+                 * 
+                 * @param j Index.
+                 * @return value_type 
+                 */
+                inline value_type operator ()(const Natural &j) const { return Operation{}(this->_scalar, this->_right(j)); }
+        };
+
+        /**
+         * @brief Scalar-right expression, op(l, s).
+         * 
+         * @tparam L Left operand.
+         * @tparam Operation Operation.
+         */
+        template<Operand L, typename Operation>
+        class Right: public Lazy {
+
+            private:
+
+                /**
+                 * @brief Left operand.
+                 * 
+                 */
+                Node<L> _left;
+
+                /**
+                 * @brief Scalar.
+                 * 
+                 */
+                Scalar<L> _scalar;
+
+            public:
+
+                // Numerical type.
+
+                using value_type = Scalar<L>;
+
+                // Constructors.
+
+                /**
+                 * @brief Constructs a new Right object.
+                 * 
+                 * @param left Left operand.
+                 * @param scalar Scalar.
+                 */
+                Right(const L &left, const value_type &scalar): _left{left}, _scalar{scalar} {}
+
+                // Access.
+
+                /**
+                 * @brief Expression's size.
+                 * 
+                 * @return Natural 
+                 */
+                inline Natural size() const { return this->_left.size(); }
+
+                /**
+                 * @brief Expression's j-th entry.
+                 * 
+                 * @param j Index.
+                 * @return value_type 
+                 */
+                inline value_type operator ()(const Natural &j) const { return Operation{}(this->_left(j), this->_scalar); }
+        };
+
+        /**
+         * @brief Same numerical type operands.
+         * 
+         * @tparam L 
+         * @tparam R 
+         */
+        template<typename L, typename R>
+        concept Compatible = Operand<L> && Operand<R> && std::same_as<Scalar<L>, Scalar<R>>;
+
+    }
+
+    #ifndef NLAZY // Lazy operations, evaluated on assignment.
+
+    /**
+     * @brief -Expression.
+     * 
+     * @tparam E Operand.
+     * @param e Operand.
+     * @return internal::Unary<E, std::negate<>> 
+     */
+    template<internal::Operand E>
+    inline internal::Unary<E, std::negate<>> operator -(const E &e) { return {e}; }
+
+    /**
+     * @brief Expression + expression.
+     * 
+     * @tparam L Left operand.
+     * @tparam R Right operand.
+     * @param l Left operand.
+     * @param r Right operand.
+     * @return internal::Binary<L, R, std::plus<>> 
+     */
+    template<typename L, typename R> requires internal::Compatible<L, R>
+    inline internal::Binary<L, R, std::plus<>> operator +(const L &l, const R &r) { return {l, r}; }
+
+    /**
+     * @brief Expression - expression.
+     * 
+     * @tparam L Left operand.
+     * @tparam R Right operand.
+     * @param l Left operand.
+     * @param r Right operand.
+     * @return internal::Binary<L, R, std::minus<>> 
+     */
+    template<typename L, typename R> requires internal::Compatible<L, R>
+    inline internal::Binary<L, R, std::minus<>> operator -(const L &l, const R &r) { return {l, r}; }
+
+    /**
+     * @brief Expression * expression, element-wise.
+     * 
+     * @tparam L Left operand.
+     * @tparam R Right operand.
+     * @param l Left operand.
+     * @param r Right operand.
+     * @return internal::Binary<L, R, std::multiplies<>> 
+     */
+    template<typename L, typename R> requires internal::Compatible<L, R>
+    inline internal::Binary<L, R, std::multiplies<>> operator *(const L &l, const R &r) { return {l, r}; }
+
+    /**
+     * @brief Expression / expression, element-wise.
+     * 
+     * @tparam L Left operand.
+     * @tparam R Right operand.
+     * @param l Left operand.
+     * @param r Right operand.
+     * @return internal::Binary<L, R, std::divides<>> 
+     */
+    template<typename L, typename R> requires internal::Compatible<L, R>
+    inline internal::Binary<L, R, std::divides<>> operator /(const L &l, const R &r) { return {l, r}; }
+
+    // Scalars.
+
+    /**
+     * @brief Expression + scalar.
+     * 
+     * @tparam L Operand.
+     * @param l Operand.
+     * @param s Scalar.
+     * @return internal::Right<L, std::plus<>> 
+     */
+    template<internal::Operand L>
+    inline internal::Right<L, std::plus<>> operator +(const L &l, const std::type_identity_t<internal::Scalar<L>> &s) { return {l, s}; }
+
+    /**
+     * @brief Scalar + expression.
+     * 
+     * @tparam R Operand.
+     * @param s Scalar.
+     * @param r Operand.
+     * @return internal::Left<R, std::plus<>> 
+     */
+    template<internal::Operand R>
+    inline internal::Left<R, std::plus<>> operator +(const std::type_identity_t<internal::Scalar<R>> &s, const R &r) { return {s, r}; }
+
+    /**
+     * @brief Expression - scalar.
+     * 
+     * @tparam L Operand.
+     * @param l Operand.
+     * @param s Scalar.
+     * @return internal::Right<L, std::minus<>> 
+     */
+    template<internal::Operand L>
+    inline internal::Right<L, std::minus<>> operator -(const L &l, const std::type_identity_t<internal::Scalar<L>> &s) { return {l, s}; }
+
+    /**
+     * @brief Scalar - expression.
+     * 
+     * @tparam R Operand.
+     * @param s Scalar.
+     * @param r Operand.
+     * @return internal::Left<R, std::minus<>> 
+     */
+    template<internal::Operand R>
+    inline internal::Left<R, std::minus<>> operator -(const std::type_identity_t<internal::Scalar<R>> &s, const R &r) { return {s, r}; }
+
+    /**
+     * @brief Expression * scalar.
+     * 
+     * @tparam L Operand.
+     * @param l Operand.
+     * @param s Scalar.
+     * @return internal::Right<L, std::multiplies<>> 
+     */
+    template<internal::Operand L>
+    inline internal::Right<L, std::multiplies<>> operator *(const L &l, const std::type_identity_t<internal::Scalar<L>> &s) { return {l, s}; }
+
+    /**
+     * @brief Scalar * expression.
+     * 
+     * @tparam R Operand.
+     * @param s Scalar.
+     * @param r Operand.
+     * @return internal::Left<R, std::multiplies<>> 
+     */
+    template<internal::Operand R>
+    inline internal::Left<R, std::multiplies<>> operator *(const std::type_identity_t<internal::Scalar<R>> &s, const R &r) { return {s, r}; }
+
+    /**
+     * @brief Expression / scalar.
+     * 
+     * @tparam L Operand.
+     * @param l Operand.
+     * @param s Scalar.
+     * @return internal::Right<L, std::divides<>> 
+     */
+    template<internal::Operand L>
+    inline internal::Right<L, std::divides<>> operator /(const L &l, const std::type_identity_t<internal::Scalar<L>> &s) { return {l, s}; }
+
+    /**
+     * @brief Scalar / expression.
+     * 
+     * @tparam R Operand.
+     * @param s Scalar.
+     * @param r Operand.
+     * @return internal::Left<R, std::divides<>> 
+     */
+    template<internal::Operand R>
+    inline internal::Left<R, std::divides<>> operator /(const std::type_identity_t<internal::Scalar<R>> &s, const R &r) { return {s, r}; }
+
+    #endif
+
+}
+
+#endif
@@ -0,0 +1,605 @@
+/**
+ * @file Fixed.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Fixed-size vectors and matrices.
+ * @date 2024-10-30
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef ALGEBRA_FIXED
+#define ALGEBRA_FIXED
+
+#include "./Matrix.hpp"
+
+namespace ivo {
+
+    /**
+     * @brief Fixed-size vectors, stack allocated.
+     * 
+     * @tparam T Numerical type.
+     * @tparam N Size.
+     */
+    template<Numerical T, Natural N> requires (N > 0)
+    class Vector<T, N> {
+
+        private:
+
+            // Attributes.
+
+            /**
+             * @brief Vector's entries.
+             * 
+             */
+            std::array<T, N> _entries;
+
+        public:
+
+            // Attributes access.
+
+            /**
+             * @brief Vector's size.
+             * 
+             * @return constexpr Natural 
+             */
+            constexpr Natural size() const { return N; }
+
+            /**
+             * @brief Vector's entries, no copy.
+             * 
+             * @return std::span<T, N> 
+             */
+            constexpr std::span<T, N> data() { return this->_entries; }
+
+            /**
+             * @brief Const vector's entries, no copy.
+             * 
+             * @return std::span<const T, N> 
+             */
+            constexpr std::span<const T, N> data() const { return this->_entries; }
+
+            // Constructors.
+
+            /**
+             * @brief Zero constructor.
+             * 
+             */
+            constexpr Vector(): _entries{} {}
+
+            /**
+             * @brief Array constructor.
+             * 
+             * @param entries Entries.
+             */
+            constexpr Vector(const std::array<T, N> &entries): _entries{entries} {}
+
+            /**
+             * @brief Entries constructor.
+             * 
+             * @tparam Ts Entries' types.
+             * @param entries Entries.
+             */
+            template<typename... Ts> requires (sizeof...(Ts) == N) && (std::convertible_to<Ts, T> && ...)
+            constexpr Vector(const Ts &... entries): _entries{static_cast<T>(entries)...} {}
+
+            /**
+             * @brief Dynamic vector constructor.
+             * 
+             * @param vector Vector.
+             */
+            explicit Vector(const Vector<T> &vector) {
+                #ifndef NDEBUG // Integrity check.
+                assert(vector.size() == N);
+                #endif
+
+                std::copy(vector.data().begin(), vector.data().end(), this->_entries.begin());
+            }
+
+            // Conversions.
+
+            /**
+             * @brief Dynamic vector conversion.
+             * 
+             * @return Vector<T> 
+             */
+            operator Vector<T>() const { return std::vector<T>(this->_entries.begin(), this->_entries.end()); }
+
+            // Access.
+
+            /**
+             * @brief Const scalar access.
+             * 
+             * @param j Index.
+             * @return constexpr T 
+             */
+            constexpr T operator ()(const Natural &j) const {
+                #ifndef NDEBUG // Integrity check.
+                assert(j < N);
+                #endif
+
+                return this->_entries[j];
+            }
+
+            /**
+             * @brief Scalar access.
+             * 
+             * @param j Index.
+             * @return constexpr T& 
+             */
+            constexpr T &operator [](const Natural &j) {
+                #ifndef NDEBUG // Integrity check.
+                assert(j < N);
+                #endif
+
+                return this->_entries[j];
+            }
+
+            // Insert.
+
+            /**
+             * @brief Scalar insert.
+             * 
+             * @param j Index.
+             * @param scalar Scalar.
+             */
+            constexpr void operator ()(const Natural &j, const T &scalar) {
+                #ifndef NDEBUG // Integrity check.
+                assert(j < N);
+                #endif
+
+                this->_entries[j] = scalar;
+            }
+
+            // Operations.
+
+            /**
+             * @brief -Vector.
+             * 
+             * @return constexpr Vector 
+             */
+            constexpr Vector operator -() const {
+                Vector result;
+
+                for(Natural j = 0; j < N; ++j)
+                    result._entries[j] = -this->_entries[j];
+
+                return result;
+            }
+
+            /**
+             * @brief Vector + vector.
+             * 
+             * @param vector Vector.
+             * @return constexpr Vector 
+             */
+            constexpr Vector operator +(const Vector &vector) const {
+                Vector result;
+
+                for(Natural j = 0; j < N; ++j)
+                    result._entries[j] = this->_entries[j] + vector._entries[j];
+
+                return result;
+            }
+
+            /**
+             * @brief Vector += vector.
+             * 
+             * @param vector Vector.
+             * @return constexpr Vector& 
+             */
+            constexpr Vector &operator +=(const Vector &vector) {
+                for(Natural j = 0; j < N; ++j)
+                    this->_entries[j] += vector._entries[j];
+
+                return *this;
+            }
+
+            /**
+             * @brief Vector - vector.
+             * 
+             * @param vector Vector.
+             * @return constexpr Vector 
+             */
+            constexpr Vector operator -(const Vector &vector) const {
+                Vector result;
+
+                for(Natural j = 0; j < N; ++j)
+                    result._entries[j] = this->_entries[j] - vector._entries[j];
+
+                return result;
+            }
+
+            /**
+             * @brief Vector -= vector.
+             * 
+             * @param vector Vector.
+             * @return constexpr Vector& 
+             */
+            constexpr Vector &operator -=(const Vector &vector) {
+                for(Natural j = 0; j < N; ++j)
+                    this->_entries[j] -= vector._entries[j];
+
+                return *this;
+            }
+
+            /**
+             * @brief Vector * scalar.
+             * 
+             * @param scalar Scalar.
+             * @return constexpr Vector 
+             */
+            constexpr Vector operator *(const T &scalar) const {
+                Vector result;
+
+                for(Natural j = 0; j < N; ++j)
+                    result._entries[j] = this->_entries[j] * scalar;
+
+                return result;
+            }
+
+            /**
+             * @brief Scalar * vector.
+             * 
+             * @param scalar Scalar.
+             * @param vector Vector.
+             * @return constexpr Vector 
+             */
+            friend constexpr Vector operator *(const T &scalar, const Vector &vector) {
+                Vector result;
+
+                for(Natural j = 0; j < N; ++j)
+                    result._entries[j] = scalar * vector._entries[j];
+
+                return result;
+            }
+
+            /**
+             * @brief Vector *= scalar.
+             * 
+             * @param scalar Scalar.
+             * @return constexpr Vector& 
+             */
+            constexpr Vector &operator *=(const T &scalar) {
+                for(Natural j = 0; j < N; ++j)
+                    this->_entries[j] *= scalar;
+
+                return *this;
+            }
+
+            /**
+             * @brief Vector / scalar.
+             * 
+             * @param scalar Scalar.
+             * @return constexpr Vector 
+             */
+            constexpr Vector operator /(const T &scalar) const {
+                Vector result;
+
+                for(Natural j = 0; j < N; ++j)
+                    result._entries[j] = this->_entries[j] / scalar;
+
+                return result;
+            }
+
+            /**
+             * @brief Vector /= scalar.
+             * 
+             * @param scalar Scalar.
+             * @return constexpr Vector& 
+             */
+            constexpr Vector &operator /=(const T &scalar) {
+                for(Natural j = 0; j < N; ++j)
+                    this->_entries[j] /= scalar;
+
+                return *this;
+            }
+
+            // Output.
+
+            /**
+             * @brief Vector output.
+             * 
+             * @param ost 
+             * @param vector Vector.
+             * @return std::ostream& 
+             */
+            friend std::ostream &operator <<(std::ostream &ost, const Vector &vector) {
+                ost << "(";
+
+                for(Natural j = 0; j < N - 1; ++j)
+                    ost << vector._entries[j] << ", ";
+
+                return ost << vector._entries[N - 1] << ")" << std::flush;
+            }
+    };
+
+    /**
+     * @brief Fixed-size matrices, stack allocated.
+     * 
+     * @tparam T Numerical type.
+     * @tparam R Rows.
+     * @tparam C Columns.
+     */
+    template<Numerical T, Natural R, Natural C> requires (R > 0) && (C > 0)
+    class Matrix<T, R, C> {
+
+        private:
+
+            // Attributes.
+
+            /**
+             * @brief Matrix' entries, by row.
+             * 
+             */
+            std::array<T, R * C> _entries;
+
+        public:
+
+            // Attributes access.
+
+            /**
+             * @brief Matrix' rows.
+             * 
+             * @return constexpr Natural 
+             */
+            constexpr Natural rows() const { return R; }
+
+            /**
+             * @brief Matrix' columns.
+             * 
+             * @return constexpr Natural 
+             */
+            constexpr Natural columns() const { return C; }
+
+            /**
+             * @brief Matrix' size.
+             * 
+             * @return constexpr Natural 
+             */
+            constexpr Natural size() const { return R * C; }
+
+            // Constructors.
+
+            /**
+             * @brief Zero constructor.
+             * 
+             */
+            constexpr Matrix(): _entries{} {}
+
+            /**
+             * @brief Array constructor, by row.
+             * 
+             * @param entries Entries.
+             */
+            constexpr Matrix(const std::array<T, R * C> &entries): _entries{entries} {}
+
+            /**
+             * @brief Dynamic matrix constructor.
+             * 
+             * @param matrix Matrix.
+             */
+            explicit Matrix(const Matrix<T> &matrix) {
+                #ifndef NDEBUG // Integrity check.
+                assert(matrix.rows() == R);
+                assert(matrix.columns() == C);
+                #endif
+
+                std::copy(matrix.data().begin(), matrix.data().end(), this->_entries.begin());
+            }
+
+            // Conversions.
+
+            /**
+             * @brief Dynamic matrix conversion.
+             * 
+             * @return Matrix<T> 
+             */
+            operator Matrix<T>() const { return Matrix<T>{R, C, std::vector<T>(this->_entries.begin(), this->_entries.end())}; }
+
+            // Access.
+
+            /**
+             * @brief Const scalar access.
+             * 
+             * @param j Row index.
+             * @param k Column index.
+             * @return constexpr T 
+             */
+            constexpr T operator ()(const Natural &j, const Natural &k) const {
+                #ifndef NDEBUG // Integrity check.
+                assert(j < R);
+                assert(k < C);
+                #endif
+
+                return this->_entries[j * C + k];
+            }
+
+            /**
+             * @brief Scalar access.
+             * 
+             * @param j Row index.
+             * @param k Column index.
+             * @return constexpr T& 
+             */
+            constexpr T &operator [](const Natural &j, const Natural &k) {
+                #ifndef NDEBUG // Integrity check.
+                assert(j < R);
+                assert(k < C);
+                #endif
+
+                return this->_entries[j * C + k];
+            }
+
+            // Insert.
+
+            /**
+             * @brief Scalar insert.
+             * 
+             * @param j Row index.
+             * @param k Column index.
+             * @param scalar Scalar.
+             */
+            constexpr void operator ()(const Natural &j, const Natural &k, const T &scalar) {
+                #ifndef NDEBUG // Integrity check.
+                assert(j < R);
+                assert(k < C);
+                #endif
+
+                this->_entries[j * C + k] = scalar;
+            }
+
+            // Methods.
+
+            /**
+             * @brief Transpose matrix.
+             * 
+             * @return constexpr Matrix<T, C, R> 
+             */
+            constexpr Matrix<T, C, R> transpose() const {
+                Matrix<T, C, R> transpose;
+
+                for(Natural j = 0; j < R; ++j)
+                    for(Natural k = 0; k < C; ++k)
+                        transpose(k, j, this->_entries[j * C + k]);
+
+                return transpose;
+            }
+
+            // Operations.
+
+            /**
+             * @brief Matrix * scalar.
+             * 
+             * @param scalar Scalar.
+             * @return constexpr Matrix 
+             */
+            constexpr Matrix operator *(const T &scalar) const {
+                Matrix result;
+
+                for(Natural j = 0; j < R * C; ++j)
+                    result._entries[j] = this->_entries[j] * scalar;
+
+                return result;
+            }
+
+            /**
+             * @brief Scalar * matrix.
+             * 
+             * @param scalar Scalar.
+             * @param matrix Matrix.
+             * @return constexpr Matrix 
+             */
+            friend constexpr Matrix operator *(const T &scalar, const Matrix &matrix) {
+                Matrix result;
+
+                for(Natural j = 0; j < R * C; ++j)
+                    result._entries[j] = scalar * matrix._entries[j];
+
+                return result;
+            }
+
+            /**
+             * @brief Matrix * vector.
+             * Row x Column product.
+             * 
+             * @param vector Vector.
+             * @return constexpr Vector<T, R> 
+             */
+            constexpr Vector<T, R> operator *(const Vector<T, C> &vector) const {
+                Vector<T, R> result;
+
+                for(Natural j = 0; j < R; ++j) {
+                    T product = static_cast<T>(0);
+
+                    for(Natural k = 0; k < C; ++k)
+                        product += this->_entries[j * C + k] * vector(k);
+
+                    result(j, product);
+                }
+
+                return result;
+            }
+
+            /**
+             * @brief Matrix * matrix.
+             * Row x Column product.
+             * 
+             * @tparam K Columns.
+             * @param matrix Matrix.
+             * @return constexpr Matrix<T, R, K> 
+             */
+            template<Natural K>
+            constexpr Matrix<T, R, K> operator *(const Matrix<T, C, K> &matrix) const {
+                Matrix<T, R, K> result;
+
+                for(Natural j = 0; j < R; ++j)
+                    for(Natural k = 0; k < K; ++k) {
+                        T product = static_cast<T>(0);
+
+                        for(Natural i = 0; i < C; ++i)
+                            product += this->_entries[j * C + i] * matrix(i, k);
+
+                        result(j, k, product);
+                    }
+
+                return result;
+            }
+
+            // Output.
+
+            /**
+             * @brief Matrix output.
+             * 
+             * @param ost 
+             * @param matrix Matrix.
+             * @return std::ostream& 
+             */
+            friend std::ostream &operator <<(std::ostream &ost, const Matrix &matrix) {
+                for(Natural j = 0; j < R; ++j) {
+                    for(Natural k = 0; k < C; ++k)
+                        ost << matrix._entries[j * C + k] << " ";
+
+                    if(j < R - 1)
+                        ost << std::endl;
+                }
+
+                return ost << std::flush;
+            }
+    };
+
+    // Methods.
+
+    /**
+     * @brief 2x2 determinant.
+     * 
+     * @tparam T Numerical type.
+     * @param A Matrix.
+     * @return constexpr T 
+     */
+    template<Numerical T>
+    constexpr T det(const Matrix<T, 2, 2> &A) {
+        return A(0, 0) * A(1, 1) - A(0, 1) * A(1, 0);
+    }
+
+    /**
+     * @brief 2x2 inverse.
+     * 
+     * @tparam T Numerical type.
+     * @param A Matrix.
+     * @return constexpr Matrix<T, 2, 2> 
+     */
+    template<Numerical T>
+    constexpr Matrix<T, 2, 2> inverse(const Matrix<T, 2, 2> &A) {
+        const T determinant = det(A);
+
+        #ifndef NDEBUG // Integrity check.
+        assert(std::abs(determinant) > constants::zero);
+        #endif
+
+        return Matrix<T, 2, 2>{{A(1, 1) / determinant, -A(0, 1) / determinant, -A(1, 0) / determinant, A(0, 0) / determinant}};
+    }
+
+}
+
+#endif
@@ -16,6 +16,13 @@
 #include <array>
 #include <tuple>
 #include <map>
+#include <span>
+#include <optional>
+
+// Memory.
+#include <memory>
+#include <memory_resource>
+#include <atomic>
 
 // Assertions.
 #include <cassert>
@@ -32,6 +39,7 @@
 
 // Output.
 #include <iostream>
+#include <sstream>
 
 // Base.
 #include "../Base.hpp"
@@ -0,0 +1,170 @@
+/**
+ * @file Kernels.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Dense row-major kernels.
+ * @date 2024-10-29
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef ALGEBRA_KERNELS
+#define ALGEBRA_KERNELS
+
+#include "./Includes.hpp"
+
+namespace ivo {
+
+    namespace internal {
+
+        /**
+         * @brief y <- Ax, row-major A.
+         * Rows are processed four at a time, sharing x's loads.
+         * 
+         * @tparam T Numerical type.
+         * @param rows A's rows.
+         * @param columns A's columns.
+         * @param A A's entries.
+         * @param x x's entries.
+         * @param y y's entries, overwritten.
+         */
+        template<Numerical T>
+        void gemv(const Natural &rows, const Natural &columns, const T *__restrict A, const T *__restrict x, T *__restrict y) {
+            Natural j = 0;
+
+            for(; j + 4 <= rows; j += 4) {
+                const T *A_0 = A + j * columns;
+                const T *A_1 = A_0 + columns;
+                const T *A_2 = A_1 + columns;
+                const T *A_3 = A_2 + columns;
+
+                T y_0 = static_cast<T>(0), y_1 = static_cast<T>(0), y_2 = static_cast<T>(0), y_3 = static_cast<T>(0);
+
+                for(Natural k = 0; k < columns; ++k) {
+                    y_0 += A_0[k] * x[k];
+                    y_1 += A_1[k] * x[k];
+                    y_2 += A_2[k] * x[k];
+                    y_3 += A_3[k] * x[k];
+                }
+
+                y[j] = y_0;
+                y[j + 1] = y_1;
+                y[j + 2] = y_2;
+                y[j + 3] = y_3;
+            }
+
+            for(; j < rows; ++j) {
+                const T *A_j = A + j * columns;
+                T y_j = static_cast<T>(0);
+
+                for(Natural k = 0; k < columns; ++k)
+                    y_j += A_j[k] * x[k];
+
+                y[j] = y_j;
+            }
+        }
+
+        /**
+         * @brief y <- x^T A, row-major A.
+         * Rows of A are accumulated in order, contiguous accesses only.
+         * 
+         * @tparam T Numerical type.
+         * @param rows A's rows.
+         * @param columns A's columns.
+         * @param A A's entries.
+         * @param x x's entries.
+         * @param y y's entries, overwritten.
+         */
+        template<Numerical T>
+        void gevm(const Natural &rows, const Natural &columns, const T *__restrict A, const T *__restrict x, T *__restrict y) {
+            std::fill(y, y + columns, static_cast<T>(0));
+
+            for(Natural j = 0; j < rows; ++j) {
+                const T *A_j = A + j * columns;
+                const T x_j = x[j];
+
+                for(Natural k = 0; k < columns; ++k)
+                    y[k] += x_j * A_j[k];
+            }
+        }
+
+        /**
+         * @brief C <- C + AB, row-major, no blocking.
+         * 
+         * @tparam T Numerical type.
+         * @param rows A's rows.
+         * @param columns B's columns.
+         * @param inner A's columns, B's rows.
+         * @param A A's entries, leading dimension lda.
+         * @param lda A's leading dimension.
+         * @param B B's entries, leading dimension ldb.
+         * @param ldb B's leading dimension.
+         * @param C C's entries, leading dimension ldc.
+         * @param ldc C's leading dimension.
+         */
+        template<Numerical T>
+        void gemm_kernel(const Natural &rows, const Natural &columns, const Natural &inner, const T *__restrict A, const Natural &lda, const T *__restrict B, const Natural &ldb, T *__restrict C, const Natural &ldc) {
+            for(Natural j = 0; j < rows; ++j) {
+                T *C_j = C + j * ldc;
+
+                for(Natural i = 0; i < inner; ++i) {
+                    const T A_ji = A[j * lda + i];
+                    const T *B_i = B + i * ldb;
+
+                    for(Natural k = 0; k < columns; ++k)
+                        C_j[k] += A_ji * B_i[k];
+                }
+            }
+        }
+
+        /**
+         * @brief C <- AB, row-major.
+         * Small products skip blocking, larger ones pack B's panels into contiguous blocks.
+         * Each entry is accumulated in the inner index' order.
+         * 
+         * @tparam T Numerical type.
+         * @param rows A's rows.
+         * @param columns B's columns.
+         * @param inner A's columns, B's rows.
+         * @param A A's entries.
+         * @param B B's entries.
+         * @param C C's entries, overwritten.
+         */
+        template<Numerical T>
+        void gemm(const Natural &rows, const Natural &columns, const Natural &inner, const T *__restrict A, const T *__restrict B, T *__restrict C) {
+            std::fill(C, C + rows * columns, static_cast<T>(0));
+
+            // Small matrices.
+            if(std::max({rows, columns, inner}) <= constants::dense_small) {
+                gemm_kernel(rows, columns, inner, A, inner, B, columns, C, columns);
+                return;
+            }
+
+            // Packed panel.
+            const Natural block = constants::dense_block;
+            std::vector<T> panel(block * block);
+
+            for(Natural k = 0; k < columns; k += block) {
+                const Natural nc = std::min(block, columns - k);
+
+                for(Natural i = 0; i < inner; i += block) {
+                    const Natural kc = std::min(block, inner - i);
+
+                    // Packing.
+                    for(Natural h = 0; h < kc; ++h)
+                        std::copy(B + (i + h) * columns + k, B + (i + h) * columns + k + nc, panel.data() + h * nc);
+
+                    for(Natural j = 0; j < rows; j += block) {
+                        const Natural mc = std::min(block, rows - j);
+
+                        gemm_kernel(mc, nc, kc, A + j * inner + i, inner, panel.data(), nc, C + j * columns + k, columns);
+                    }
+                }
+            }
+        }
+
+    }
+
+}
+
+#endif
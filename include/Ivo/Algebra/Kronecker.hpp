@@ -0,0 +1,423 @@
+/**
+ * @file Kronecker.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Implicit Kronecker products.
+ * @date 2024-11-02
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef ALGEBRA_KRONECKER
+#define ALGEBRA_KRONECKER
+
+#include "./Sparse.hpp"
+#include "./Kernels.hpp"
+#include "./Methods/Vector.hpp"
+
+namespace ivo {
+
+    namespace internal {
+
+        /**
+         * @brief Kronecker product's factor.
+         * Dense row-major or CSR storage.
+         * 
+         * @tparam T Numerical type.
+         */
+        template<Numerical T>
+        class Factor {
+
+            private:
+
+                // Attributes.
+
+                /**
+                 * @brief Factor's rows.
+                 * 
+                 */
+                Natural _rows;
+
+                /**
+                 * @brief Factor's columns.
+                 * 
+                 */
+                Natural _columns;
+
+                /**
+                 * @brief Sparse state.
+                 * 
+                 */
+                bool _sparse;
+
+                /**
+                 * @brief Factor's entries, dense or CSR.
+                 * 
+                 */
+                std::vector<T> _entries;
+
+                /**
+                 * @brief CSR Inner vector.
+                 * 
+                 */
+                std::vector<Natural> _inner;
+
+                /**
+                 * @brief CSR Outer vector.
+                 * 
+                 */
+                std::vector<Natural> _outer;
+
+            public:
+
+                // Constructors.
+
+                /**
+                 * @brief Dense factor.
+                 * 
+                 * @param matrix Matrix.
+                 */
+                Factor(const Matrix<T> &matrix): _rows{matrix.rows()}, _columns{matrix.columns()}, _sparse{false} {
+                    this->_entries.assign(matrix.data().begin(), matrix.data().end());
+                }
+
+                /**
+                 * @brief Sparse factor.
+                 * 
+                 * @param sparse Sparse matrix.
+                 */
+                Factor(Sparse<T> &sparse): _rows{sparse.rows()}, _columns{sparse.columns()}, _sparse{true} {
+                    std::tie(this->_inner, this->_outer, this->_entries) = sparse.csr();
+                }
+
+                // Attributes access.
+
+                /**
+                 * @brief Factor's rows.
+                 * 
+                 * @return Natural 
+                 */
+                constexpr Natural rows() const { return this->_rows; }
+
+                /**
+                 * @brief Factor's columns.
+                 * 
+                 * @return Natural 
+                 */
+                constexpr Natural columns() const { return this->_columns; }
+
+                // Products.
+
+                /**
+                 * @brief C <- FB, row-major B with a given number of columns.
+                 * 
+                 * @param columns B's columns.
+                 * @param B B's entries.
+                 * @param C C's entries, overwritten.
+                 */
+                void multiply(const Natural &columns, const T *__restrict B, T *__restrict C) const {
+                    if(!this->_sparse) {
+                        if(columns == 1)
+                            gemv(this->_rows, this->_columns, this->_entries.data(), B, C);
+                        else
+                            gemm(this->_rows, columns, this->_columns, this->_entries.data(), B, C);
+
+                        return;
+                    }
+
+                    std::fill(C, C + this->_rows * columns, static_cast<T>(0));
+
+                    for(Natural j = 0; j < this->_rows; ++j) {
+                        T *C_j = C + j * columns;
+
+                        for(Natural h = this->_inner[j]; h < this->_inner[j + 1]; ++h) {
+                            const T F_jh = this->_entries[h];
+                            const T *B_h = B + this->_outer[h] * columns;
+
+                            for(Natural k = 0; k < columns; ++k)
+                                C_j[k] += F_jh * B_h[k];
+                        }
+                    }
+                }
+        };
+
+    }
+
+    /**
+     * @brief Implicit Kronecker product, a(X ⊗ Y).
+     * The product is never formed: with row-major indexing, (X ⊗ Y)vec(Z) = vec(X Z Y^T).
+     * Applying it costs X.columns() products by Y and one product by X.
+     * 
+     * @tparam T Numerical type.
+     */
+    template<Numerical T>
+    class Kronecker {
+
+        private:
+
+            // Attributes.
+
+            /**
+             * @brief First factor.
+             * 
+             */
+            internal::Factor<T> _X;
+
+            /**
+             * @brief Second factor.
+             * 
+             */
+            internal::Factor<T> _Y;
+
+            /**
+             * @brief Coefficient.
+             * 
+             */
+            T _coefficient = static_cast<T>(1);
+
+        public:
+
+            // Constructors.
+
+            /**
+             * @brief Dense Kronecker product.
+             * 
+             * @param X First matrix.
+             * @param Y Second matrix.
+             */
+            Kronecker(const Matrix<T> &X, const Matrix<T> &Y): _X{X}, _Y{Y} {}
+
+            /**
+             * @brief Sparse-dense Kronecker product.
+             * 
+             * @param X First sparse matrix.
+             * @param Y Second matrix.
+             */
+            Kronecker(Sparse<T> &X, const Matrix<T> &Y): _X{X}, _Y{Y} {}
+
+            /**
+             * @brief Dense-sparse Kronecker product.
+             * 
+             * @param X First matrix.
+             * @param Y Second sparse matrix.
+             */
+            Kronecker(const Matrix<T> &X, Sparse<T> &Y): _X{X}, _Y{Y} {}
+
+            /**
+             * @brief Sparse Kronecker product.
+             * 
+             * @param X First sparse matrix.
+             * @param Y Second sparse matrix.
+             */
+            Kronecker(Sparse<T> &X, Sparse<T> &Y): _X{X}, _Y{Y} {}
+
+            // Attributes access.
+
+            /**
+             * @brief Kronecker's rows.
+             * 
+             * @return Natural 
+             */
+            constexpr Natural rows() const { return this->_X.rows() * this->_Y.rows(); }
+
+            /**
+             * @brief Kronecker's columns.
+             * 
+             * @return Natural 
+             */
+            constexpr Natural columns() const { return this->_X.columns() * this->_Y.columns(); }
+
+            // Operations.
+
+            /**
+             * @brief Scalar * Kronecker.
+             * 
+             * @param scalar Scalar.
+             * @param kronecker Kronecker product.
+             * @return Kronecker 
+             */
+            friend Kronecker operator *(const T &scalar, Kronecker kronecker) {
+                kronecker._coefficient *= scalar;
+                return kronecker;
+            }
+
+            /**
+             * @brief Kronecker * vector.
+             * 
+             * @param vector Vector.
+             * @return Vector<T> 
+             */
+            Vector<T> operator *(const Vector<T> &vector) const {
+                #ifndef NDEBUG // Integrity check.
+                assert(vector.size() == this->columns());
+                #endif
+
+                Vector<T> result{this->rows()};
+                this->apply(vector.data().data(), result.data().data());
+                return result;
+            }
+
+            /**
+             * @brief y <- a(X ⊗ Y)x.
+             * 
+             * @param x x's entries.
+             * @param y y's entries, overwritten.
+             */
+            void apply(const T *x, T *y) const {
+                const Natural xr = this->_X.rows(), xc = this->_X.columns();
+                const Natural yr = this->_Y.rows(), yc = this->_Y.columns();
+
+                // ZY^T, row by row.
+                Vector<T> ZY{xc * yr};
+                T *zy = ZY.data().data();
+
+                for(Natural k = 0; k < xc; ++k)
+                    this->_Y.multiply(1, x + k * yc, zy + k * yr);
+
+                // X(ZY^T).
+                this->_X.multiply(yr, zy, y);
+
+                if(this->_coefficient != static_cast<T>(1))
+                    for(Natural j = 0; j < xr * yr; ++j)
+                        y[j] *= this->_coefficient;
+            }
+    };
+
+    /**
+     * @brief Sum of implicit Kronecker products.
+     * Space-time blocks as sums of time ⊗ space terms.
+     * 
+     * @tparam T Numerical type.
+     */
+    template<Numerical T>
+    class Kroneckers {
+
+        private:
+
+            // Attributes.
+
+            /**
+             * @brief Terms.
+             * 
+             */
+            std::vector<Kronecker<T>> _terms;
+
+        public:
+
+            // Constructors.
+
+            /**
+             * @brief Single term constructor.
+             * 
+             * @param term Kronecker product.
+             */
+            Kroneckers(const Kronecker<T> &term): _terms{term} {}
+
+            // Attributes access.
+
+            /**
+             * @brief Sum's rows.
+             * 
+             * @return Natural 
+             */
+            inline Natural rows() const { return this->_terms[0].rows(); }
+
+            /**
+             * @brief Sum's columns.
+             * 
+             * @return Natural 
+             */
+            inline Natural columns() const { return this->_terms[0].columns(); }
+
+            /**
+             * @brief Number of terms.
+             * 
+             * @return Natural 
+             */
+            inline Natural terms() const { return this->_terms.size(); }
+
+            // Operations.
+
+            /**
+             * @brief Kroneckers += Kronecker.
+             * 
+             * @param term Kronecker product.
+             * @return Kroneckers& 
+             */
+            Kroneckers &operator +=(const Kronecker<T> &term) {
+                #ifndef NDEBUG // Integrity check.
+                assert((this->rows() == term.rows()) && (this->columns() == term.columns()));
+                #endif
+
+                this->_terms.emplace_back(term);
+                return *this;
+            }
+
+            /**
+             * @brief Kroneckers += Kroneckers.
+             * 
+             * @param sum Sum of Kronecker products.
+             * @return Kroneckers& 
+             */
+            Kroneckers &operator +=(const Kroneckers &sum) {
+
+                // Self-addition safe, no reallocation while appending.
+                const Natural terms = sum._terms.size();
+                this->_terms.reserve(this->_terms.size() + terms);
+
+                for(Natural j = 0; j < terms; ++j)
+                    *this += sum._terms[j];
+
+                return *this;
+            }
+
+            /**
+             * @brief Kroneckers + Kronecker.
+             * 
+             * @param sum Sum of Kronecker products.
+             * @param term Kronecker product.
+             * @return Kroneckers 
+             */
+            friend Kroneckers operator +(Kroneckers sum, const Kronecker<T> &term) {
+                return sum += term;
+            }
+
+            /**
+             * @brief Kroneckers * vector.
+             * 
+             * @param vector Vector.
+             * @return Vector<T> 
+             */
+            Vector<T> operator *(const Vector<T> &vector) const {
+                #ifndef NDEBUG // Integrity check.
+                assert(vector.size() == this->columns());
+                #endif
+
+                Vector<T> result{this->rows()};
+                Vector<T> term{this->rows()};
+
+                for(const auto &kronecker: this->_terms) {
+                    kronecker.apply(vector.data().data(), term.data().data());
+                    axpy(static_cast<T>(1), term, result);
+                }
+
+                return result;
+            }
+    };
+
+    /**
+     * @brief Kronecker + Kronecker.
+     * 
+     * @tparam T Numerical type.
+     * @param first First Kronecker product.
+     * @param second Second Kronecker product.
+     * @return Kroneckers<T> 
+     */
+    template<Numerical T>
+    Kroneckers<T> operator +(const Kronecker<T> &first, const Kronecker<T> &second) {
+        return Kroneckers<T>{first} += second;
+    }
+
+}
+
+#endif
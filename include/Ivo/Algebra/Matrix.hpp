@@ -12,6 +12,7 @@
 #define ALGEBRA_MATRIX
 
 #include "./Vector.hpp"
+#include "./Kernels.hpp"
 
 namespace ivo {
     
@@ -19,8 +20,10 @@ namespace ivo {
      * @brief Dinamically allocated matrices.
      * 
      * @tparam T Numerical type.
+     * @tparam R Rows, fixed for R, C > 0 (Fixed.hpp).
+     * @tparam C Columns, fixed for R, C > 0 (Fixed.hpp).
      */
-    template<Numerical T>
+    template<Numerical T, Natural R = 0, Natural C = 0>
     class Matrix {
 
         private:
@@ -28,22 +31,22 @@ namespace ivo {
             // Attributes.
 
             /**
-             * @brief Matrix' entries, by row.
+             * @brief Matrix' entries, by row, from the thread's current resource.
              * 
              */
-            std::vector<T> _entries;
+            std::pmr::vector<T> _entries;
 
             /**
              * @brief Matrix' rows.
              * 
              */
-            const Natural _rows;
+            Natural _rows;
 
             /**
              * @brief Matrix' columns.
              * 
              */
-            const Natural _columns;
+            Natural _columns;
 
         public:
 
@@ -54,7 +57,21 @@ namespace ivo {
              * 
              * @return std::vector<T> 
              */
-            inline std::vector<T> entries() const { return this->_entries; }
+            inline std::vector<T> entries() const { return {this->_entries.begin(), this->_entries.end()}; }
+
+            /**
+             * @brief Matrix' entries, by row, no copy.
+             * 
+             * @return std::span<T> 
+             */
+            inline std::span<T> data() { return this->_entries; }
+
+            /**
+             * @brief Const matrix' entries, by row, no copy.
+             * 
+             * @return std::span<const T> 
+             */
+            inline std::span<const T> data() const { return this->_entries; }
 
             /**
              * @brief Matrix' rows.
@@ -85,7 +102,7 @@ namespace ivo {
              * @param rows Matrix' rows.
              * @param columns Matrix' columns.
              */
-            Matrix(const Natural &rows, const Natural &columns): _rows{rows}, _columns{columns} {
+            Matrix(const Natural &rows, const Natural &columns): _entries(internal::resource()), _rows{rows}, _columns{columns} {
                 #ifndef NDEBUG // Integrity check.
                 assert(rows > 0);
                 assert(columns > 0);
@@ -101,7 +118,7 @@ namespace ivo {
              * @param columns Matrix' columns.
              * @param scalar Scalar.
              */
-            Matrix(const Natural &rows, const Natural &columns, const T &scalar): _rows{rows}, _columns{columns} {
+            Matrix(const Natural &rows, const Natural &columns, const T &scalar): _entries(internal::resource()), _rows{rows}, _columns{columns} {
                 #ifndef NDEBUG // Integrity check.
                 assert(rows > 0);
                 assert(columns > 0);
@@ -117,7 +134,7 @@ namespace ivo {
              * @param columns Matrix' columns.
              * @param vector Standard vector.
              */
-            Matrix(const Natural &rows, const Natural &columns, const std::vector<T> &vector): _rows{rows}, _columns{columns} {
+            Matrix(const Natural &rows, const Natural &columns, const std::vector<T> &vector): _entries(internal::resource()), _rows{rows}, _columns{columns} {
                 #ifndef NDEBUG // Integrity check.
                 assert(rows > 0);
                 assert(columns > 0);
@@ -135,14 +152,22 @@ namespace ivo {
              * @param columns Matrix' columns.
              * @param vector Vector.
              */
-            Matrix(const Natural &rows, const Natural &columns, const Vector<T> &vector): Matrix(rows, columns, vector.entries()) {}
+            Matrix(const Natural &rows, const Natural &columns, const Vector<T> &vector): _entries(internal::resource()), _rows{rows}, _columns{columns} {
+                #ifndef NDEBUG // Integrity check.
+                assert(rows > 0);
+                assert(columns > 0);
+                assert(rows * columns == vector.size());
+                #endif
+
+                this->_entries.assign(vector.data().begin(), vector.data().end());
+            }
 
             /**
              * @brief Copy constructor.
              * 
              * @param matrix Matrix.
              */
-            Matrix(const Matrix &matrix): _rows{matrix._rows}, _columns{matrix._columns} {
+            Matrix(const Matrix &matrix): _entries(internal::resource()), _rows{matrix._rows}, _columns{matrix._columns} {
                 this->_entries.resize(this->_rows * this->_columns, static_cast<T>(0));
                 std::copy(matrix._entries.begin(), matrix._entries.end(), this->_entries.begin());
             }
@@ -163,6 +188,38 @@ namespace ivo {
                 return *this;
             }
 
+            /**
+             * @brief Move constructor.
+             * 
+             * @param matrix Matrix.
+             */
+            Matrix(Matrix &&matrix) noexcept: _entries{std::move(matrix._entries)}, _rows{matrix._rows}, _columns{matrix._columns} {
+                matrix._entries.clear();
+                matrix._rows = 0;
+                matrix._columns = 0;
+            }
+
+            /**
+             * @brief Move operator.
+             * 
+             * @param matrix Matrix.
+             * @return Matrix& 
+             */
+            Matrix &operator =(Matrix &&matrix) noexcept {
+                if(this == &matrix)
+                    return *this;
+
+                this->_entries = std::move(matrix._entries);
+                this->_rows = matrix._rows;
+                this->_columns = matrix._columns;
+
+                // Valid empty source, entries are copied across different resources.
+                matrix._entries.clear();
+                matrix._rows = 0;
+                matrix._columns = 0;
+                return *this;
+            }
+
             // Access.
 
             /**
@@ -293,9 +350,7 @@ namespace ivo {
                 assert(this->_columns == vector.size());
                 #endif
 
-                // std::vector for built-in copy.
-                std::vector<T> row = vector.entries();
-                std::copy(row.begin(), row.end(), this->_entries.begin() + j * this->_columns);
+                std::copy(vector.data().begin(), vector.data().end(), this->_entries.begin() + j * this->_columns);
             }
 
             /**
@@ -594,15 +649,7 @@ namespace ivo {
                 #endif
 
                 Vector<T> result{this->_rows};
-                for(Natural j = 0; j < this->_rows; ++j) {
-                    T product = static_cast<T>(0);
-
-                    for(Natural k = 0; k < this->_columns; ++k)
-                        product += this->_entries[j * this->_columns + k] * vector(k);
-                    
-                    result(j, product);
-                }
-
+                internal::gemv(this->_rows, this->_columns, this->_entries.data(), vector.data().data(), result.data().data());
                 return result;
             }
 
@@ -620,15 +667,7 @@ namespace ivo {
                 #endif
 
                 Vector<T> result{matrix._columns};
-                for(Natural k = 0; k < matrix._columns; ++k) {
-                    T product = static_cast<T>(0);
-
-                    for(Natural j = 0; j < matrix._rows; ++j)
-                        product += vector(j) * matrix._entries[j * matrix._columns + k];
-                    
-                    result(k, product);
-                }
-
+                internal::gevm(matrix._rows, matrix._columns, matrix._entries.data(), vector.data().data(), result.data().data());
                 return result;
             }
 
@@ -639,22 +678,13 @@ namespace ivo {
              * @param matrix Matrix.
              * @return Matrix 
              */
-            Matrix operator *(const Matrix &matrix) {
+            Matrix operator *(const Matrix &matrix) const {
                 #ifndef NDEBUG // Integrity check.
                 assert(this->_columns == matrix._rows);
                 #endif
 
                 Matrix result{this->_rows, matrix._columns};
-                for(Natural j = 0; j < this->_rows; ++j)
-                    for(Natural k = 0; k < matrix._columns; ++k) {
-                        T product = static_cast<T>(0);
-
-                        for(Natural i = 0; i < this->_columns; ++i)
-                            product += this->_entries[j * this->_columns + i] * matrix._entries[i * matrix._columns + k];
-
-                        result._entries[j * matrix._columns + k] = product;
-                    }
-
+                internal::gemm(this->_rows, matrix._columns, this->_columns, this->_entries.data(), matrix._entries.data(), result._entries.data());
                 return result;
             }
 
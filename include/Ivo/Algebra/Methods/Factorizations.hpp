@@ -0,0 +1,604 @@
+/**
+ * @file Factorizations.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Dense factorizations.
+ * @date 2024-10-31
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef ALGEBRA_METHODS_FACTORIZATIONS
+#define ALGEBRA_METHODS_FACTORIZATIONS
+
+#include "../Matrix.hpp"
+
+namespace ivo {
+
+    /**
+     * @brief Blocked LU factorization with partial pivoting, PA = LU.
+     * 
+     * @tparam T Numerical type.
+     */
+    template<Numerical T>
+    class LU {
+
+        private:
+
+            // Attributes.
+
+            /**
+             * @brief L (unit, strictly lower) and U factors, by row.
+             * 
+             */
+            Matrix<T> _factors;
+
+            /**
+             * @brief Row permutation, P.
+             * 
+             */
+            std::vector<Natural> _permutation;
+
+        public:
+
+            // Attributes access.
+
+            /**
+             * @brief Factorization's size.
+             * 
+             * @return Natural 
+             */
+            inline Natural size() const { return this->_factors.rows(); }
+
+            // Constructors.
+
+            /**
+             * @brief Constructs a new LU object.
+             * Right-looking, panels of dense_block columns.
+             * 
+             * @param A Matrix.
+             */
+            LU(const Matrix<T> &A): _factors{A}, _permutation(A.rows()) {
+                #ifndef NDEBUG // Integrity check.
+                assert(A.rows() == A.columns());
+                #endif
+
+                const Natural n = A.rows();
+                std::span<T> a = this->_factors.data();
+
+                std::iota(this->_permutation.begin(), this->_permutation.end(), 0);
+
+                for(Natural k0 = 0; k0 < n; k0 += constants::dense_block) {
+                    const Natural k1 = std::min(n, k0 + constants::dense_block);
+
+                    // Panel.
+                    for(Natural k = k0; k < k1; ++k) {
+
+                        // Pivoting.
+                        Natural pivot = k;
+
+                        for(Natural j = k + 1; j < n; ++j)
+                            if(std::abs(a[j * n + k]) > std::abs(a[pivot * n + k]))
+                                pivot = j;
+
+                        #ifndef NDEBUG // Integrity check.
+                        assert(std::abs(a[pivot * n + k]) > constants::zero);
+                        #endif
+
+                        if(pivot != k) {
+                            std::swap_ranges(a.begin() + k * n, a.begin() + (k + 1) * n, a.begin() + pivot * n);
+                            std::swap(this->_permutation[k], this->_permutation[pivot]);
+                        }
+
+                        // Elimination, panel's columns only.
+                        for(Natural j = k + 1; j < n; ++j) {
+                            a[j * n + k] /= a[k * n + k];
+
+                            for(Natural h = k + 1; h < k1; ++h)
+                                a[j * n + h] -= a[j * n + k] * a[k * n + h];
+                        }
+                    }
+
+                    // U's block row, L_11^-1 A_12.
+                    for(Natural k = k0; k < k1; ++k)
+                        for(Natural j = k + 1; j < k1; ++j)
+                            for(Natural h = k1; h < n; ++h)
+                                a[j * n + h] -= a[j * n + k] * a[k * n + h];
+
+                    // Trailing update, A_22 - L_21 U_12.
+                    for(Natural j = k1; j < n; ++j)
+                        for(Natural k = k0; k < k1; ++k) {
+                            const T l = a[j * n + k];
+
+                            for(Natural h = k1; h < n; ++h)
+                                a[j * n + h] -= l * a[k * n + h];
+                        }
+                }
+            }
+
+            // Methods.
+
+            /**
+             * @brief Solves Ax = b for x.
+             * 
+             * @param b Vector.
+             * @return Vector<T> 
+             */
+            Vector<T> solve(const Vector<T> &b) const {
+                return this->solve(Matrix<T>{b.size(), 1, b}).column(0);
+            }
+
+            /**
+             * @brief Solves AX = B for X, multiple right-hand sides.
+             * 
+             * @param B Matrix, right-hand sides by column.
+             * @return Matrix<T> 
+             */
+            Matrix<T> solve(const Matrix<T> &B) const {
+                #ifndef NDEBUG // Integrity check.
+                assert(B.rows() == this->size());
+                #endif
+
+                const Natural n = this->size();
+                const Natural m = B.columns();
+
+                std::span<const T> a = this->_factors.data();
+                std::span<const T> b = B.data();
+
+                Matrix<T> X{n, m};
+                std::span<T> x = X.data();
+
+                // Forward substitution, Ly = Pb.
+                for(Natural j = 0; j < n; ++j) {
+                    std::copy(b.begin() + this->_permutation[j] * m, b.begin() + (this->_permutation[j] + 1) * m, x.begin() + j * m);
+
+                    for(Natural k = 0; k < j; ++k)
+                        for(Natural h = 0; h < m; ++h)
+                            x[j * m + h] -= a[j * n + k] * x[k * m + h];
+                }
+
+                // Backward substitution, Ux = y.
+                for(Natural j = n; j > 0; --j) {
+                    for(Natural k = j; k < n; ++k)
+                        for(Natural h = 0; h < m; ++h)
+                            x[(j - 1) * m + h] -= a[(j - 1) * n + k] * x[k * m + h];
+
+                    for(Natural h = 0; h < m; ++h)
+                        x[(j - 1) * m + h] /= a[(j - 1) * n + j - 1];
+                }
+
+                return X;
+            }
+
+            /**
+             * @brief Determinant.
+             * 
+             * @return T 
+             */
+            T determinant() const {
+                T determinant = static_cast<T>(1);
+
+                for(Natural j = 0; j < this->size(); ++j)
+                    determinant *= this->_factors(j, j);
+
+                // Permutation's sign.
+                std::vector<bool> visited(this->size(), false);
+
+                for(Natural j = 0; j < this->size(); ++j) {
+                    if(visited[j])
+                        continue;
+
+                    Natural length = 0;
+
+                    for(Natural k = j; !visited[k]; k = this->_permutation[k]) {
+                        visited[k] = true;
+                        ++length;
+                    }
+
+                    if(length % 2 == 0)
+                        determinant = -determinant;
+                }
+
+                return determinant;
+            }
+    };
+
+    /**
+     * @brief Blocked Cholesky factorization, A = LL^T.
+     * 
+     * @tparam T Numerical type.
+     */
+    template<Numerical T>
+    class Cholesky {
+
+        private:
+
+            // Attributes.
+
+            /**
+             * @brief L factor, lower, by row.
+             * 
+             */
+            Matrix<T> _factor;
+
+        public:
+
+            // Attributes access.
+
+            /**
+             * @brief Factorization's size.
+             * 
+             * @return Natural 
+             */
+            inline Natural size() const { return this->_factor.rows(); }
+
+            /**
+             * @brief L factor.
+             * 
+             * @return Matrix<T> 
+             */
+            inline Matrix<T> factor() const { return this->_factor; }
+
+            // Constructors.
+
+            /**
+             * @brief Constructs a new Cholesky object.
+             * Right-looking, panels of dense_block columns, A's lower triangle only.
+             * 
+             * @param A Symmetric positive definite matrix.
+             */
+            Cholesky(const Matrix<T> &A): _factor{A} {
+                #ifndef NDEBUG // Integrity check.
+                assert(A.rows() == A.columns());
+                #endif
+
+                const Natural n = A.rows();
+                std::span<T> a = this->_factor.data();
+
+                for(Natural k0 = 0; k0 < n; k0 += constants::dense_block) {
+                    const Natural k1 = std::min(n, k0 + constants::dense_block);
+
+                    // Panel.
+                    for(Natural k = k0; k < k1; ++k) {
+
+                        #ifndef NDEBUG // Integrity check.
+                        assert(a[k * n + k] > constants::zero);
+                        #endif
+
+                        a[k * n + k] = std::sqrt(a[k * n + k]);
+
+                        for(Natural j = k + 1; j < n; ++j) {
+                            a[j * n + k] /= a[k * n + k];
+
+                            for(Natural h = k + 1; h < std::min(j + 1, k1); ++h)
+                                a[j * n + h] -= a[j * n + k] * a[h * n + k];
+                        }
+                    }
+
+                    // Trailing update, A_22 - L_21 L_21^T, lower triangle.
+                    for(Natural j = k1; j < n; ++j)
+                        for(Natural h = k1; h <= j; ++h) {
+                            T product = static_cast<T>(0);
+
+                            for(Natural k = k0; k < k1; ++k)
+                                product += a[j * n + k] * a[h * n + k];
+
+                            a[j * n + h] -= product;
+                        }
+                }
+
+                // Upper triangle.
+                for(Natural j = 0; j < n; ++j)
+                    std::fill(a.begin() + j * n + j + 1, a.begin() + (j + 1) * n, static_cast<T>(0));
+            }
+
+            // Methods.
+
+            /**
+             * @brief Solves Ax = b for x.
+             * 
+             * @param b Vector.
+             * @return Vector<T> 
+             */
+            Vector<T> solve(const Vector<T> &b) const {
+                return this->solve(Matrix<T>{b.size(), 1, b}).column(0);
+            }
+
+            /**
+             * @brief Solves AX = B for X, multiple right-hand sides.
+             * 
+             * @param B Matrix, right-hand sides by column.
+             * @return Matrix<T> 
+             */
+            Matrix<T> solve(const Matrix<T> &B) const {
+                #ifndef NDEBUG // Integrity check.
+                assert(B.rows() == this->size());
+                #endif
+
+                const Natural n = this->size();
+                const Natural m = B.columns();
+
+                std::span<const T> a = this->_factor.data();
+
+                Matrix<T> X{B};
+                std::span<T> x = X.data();
+
+                // Forward substitution, Ly = b.
+                for(Natural j = 0; j < n; ++j) {
+                    for(Natural k = 0; k < j; ++k)
+                        for(Natural h = 0; h < m; ++h)
+                            x[j * m + h] -= a[j * n + k] * x[k * m + h];
+
+                    for(Natural h = 0; h < m; ++h)
+                        x[j * m + h] /= a[j * n + j];
+                }
+
+                // Backward substitution, L^T x = y.
+                for(Natural j = n; j > 0; --j) {
+                    for(Natural h = 0; h < m; ++h)
+                        x[(j - 1) * m + h] /= a[(j - 1) * n + j - 1];
+
+                    for(Natural k = 0; k < j - 1; ++k)
+                        for(Natural h = 0; h < m; ++h)
+                            x[k * m + h] -= a[(j - 1) * n + k] * x[(j - 1) * m + h];
+                }
+
+                return X;
+            }
+    };
+
+    /**
+     * @brief Householder QR factorization, A = QR.
+     * 
+     * @tparam T Numerical type.
+     */
+    template<Numerical T>
+    class QR {
+
+        private:
+
+            // Attributes.
+
+            /**
+             * @brief R (upper) and Householder vectors (strictly lower, unit leading entry), by row.
+             * 
+             */
+            Matrix<T> _factors;
+
+            /**
+             * @brief Householder coefficients, H_k = I - beta_k v_k v_k^T.
+             * 
+             */
+            std::vector<T> _betas;
+
+        public:
+
+            // Attributes access.
+
+            /**
+             * @brief Factored matrix' rows.
+             * 
+             * @return Natural 
+             */
+            inline Natural rows() const { return this->_factors.rows(); }
+
+            /**
+             * @brief Factored matrix' columns.
+             * 
+             * @return Natural 
+             */
+            inline Natural columns() const { return this->_factors.columns(); }
+
+            /**
+             * @brief R factor.
+             * 
+             * @return Matrix<T> 
+             */
+            Matrix<T> R() const {
+                Matrix<T> R{this->columns(), this->columns()};
+
+                for(Natural j = 0; j < this->columns(); ++j)
+                    for(Natural k = j; k < this->columns(); ++k)
+                        R(j, k, this->_factors(j, k));
+
+                return R;
+            }
+
+            // Constructors.
+
+            /**
+             * @brief Constructs a new QR object.
+             * 
+             * @param A Matrix, rows >= columns.
+             */
+            QR(const Matrix<T> &A): _factors{A}, _betas(A.columns(), static_cast<T>(0)) {
+                #ifndef NDEBUG // Integrity check.
+                assert(A.rows() >= A.columns());
+                #endif
+
+                const Natural m = A.rows();
+                const Natural n = A.columns();
+
+                std::span<T> a = this->_factors.data();
+                std::vector<T> w(n);
+
+                for(Natural k = 0; k < n; ++k) {
+
+                    // Reflector.
+                    T squared = static_cast<T>(0);
+
+                    for(Natural j = k; j < m; ++j)
+                        squared += a[j * n + k] * a[j * n + k];
+
+                    if(squared <= constants::zero)
+                        continue;
+
+                    const T alpha = (a[k * n + k] > static_cast<T>(0)) ? -std::sqrt(squared) : std::sqrt(squared);
+                    const T v_0 = a[k * n + k] - alpha;
+
+                    // v = x - alpha e_1, scaled to v_0 = 1.
+                    for(Natural j = k + 1; j < m; ++j)
+                        a[j * n + k] /= v_0;
+
+                    const T beta = -v_0 / alpha;
+                    this->_betas[k] = beta;
+
+                    a[k * n + k] = alpha;
+
+                    // Application to the trailing columns, by row.
+                    std::fill(w.begin() + k + 1, w.end(), static_cast<T>(0));
+
+                    for(Natural j = k; j < m; ++j) {
+                        const T v_j = (j == k) ? static_cast<T>(1) : a[j * n + k];
+
+                        for(Natural h = k + 1; h < n; ++h)
+                            w[h] += v_j * a[j * n + h];
+                    }
+
+                    for(Natural j = k; j < m; ++j) {
+                        const T v_j = (j == k) ? static_cast<T>(1) : a[j * n + k];
+
+                        for(Natural h = k + 1; h < n; ++h)
+                            a[j * n + h] -= beta * v_j * w[h];
+                    }
+                }
+            }
+
+            // Methods.
+
+            /**
+             * @brief Solves min |Ax - b| for x.
+             * 
+             * @param b Vector.
+             * @return Vector<T> 
+             */
+            Vector<T> solve(const Vector<T> &b) const {
+                return this->solve(Matrix<T>{b.size(), 1, b}).column(0);
+            }
+
+            /**
+             * @brief Solves min |AX - B| for X, multiple right-hand sides.
+             * 
+             * @param B Matrix, right-hand sides by column.
+             * @return Matrix<T> 
+             */
+            Matrix<T> solve(const Matrix<T> &B) const {
+                #ifndef NDEBUG // Integrity check.
+                assert(B.rows() == this->rows());
+                #endif
+
+                const Natural m = this->rows();
+                const Natural n = this->columns();
+                const Natural r = B.columns();
+
+                std::span<const T> a = this->_factors.data();
+
+                Matrix<T> Y{B};
+                std::span<T> y = Y.data();
+                std::vector<T> w(r);
+
+                // Q^T B.
+                for(Natural k = 0; k < n; ++k) {
+                    if(this->_betas[k] == static_cast<T>(0))
+                        continue;
+
+                    std::fill(w.begin(), w.end(), static_cast<T>(0));
+
+                    for(Natural j = k; j < m; ++j) {
+                        const T v_j = (j == k) ? static_cast<T>(1) : a[j * n + k];
+
+                        for(Natural h = 0; h < r; ++h)
+                            w[h] += v_j * y[j * r + h];
+                    }
+
+                    for(Natural j = k; j < m; ++j) {
+                        const T v_j = (j == k) ? static_cast<T>(1) : a[j * n + k];
+
+                        for(Natural h = 0; h < r; ++h)
+                            y[j * r + h] -= this->_betas[k] * v_j * w[h];
+                    }
+                }
+
+                // Backward substitution, RX = (Q^T B)_n.
+                Matrix<T> X{n, r};
+                std::span<T> x = X.data();
+
+                for(Natural j = n; j > 0; --j) {
+                    std::copy(y.begin() + (j - 1) * r, y.begin() + j * r, x.begin() + (j - 1) * r);
+
+                    for(Natural k = j; k < n; ++k)
+                        for(Natural h = 0; h < r; ++h)
+                            x[(j - 1) * r + h] -= a[(j - 1) * n + k] * x[k * r + h];
+
+                    #ifndef NDEBUG // Integrity check.
+                    assert(std::abs(a[(j - 1) * n + j - 1]) > constants::zero);
+                    #endif
+
+                    for(Natural h = 0; h < r; ++h)
+                        x[(j - 1) * r + h] /= a[(j - 1) * n + j - 1];
+                }
+
+                return X;
+            }
+    };
+
+    // Batched factorizations.
+
+    /**
+     * @brief Factors many blocks at once.
+     * 
+     * @tparam Factorization LU, Cholesky or QR.
+     * @tparam T Numerical type.
+     * @param blocks Blocks.
+     * @return std::vector<Factorization> 
+     */
+    template<template<Numerical> typename Factorization, Numerical T>
+    std::vector<Factorization<T>> factorize(const std::vector<Matrix<T>> &blocks) {
+        std::vector<std::optional<Factorization<T>>> factors(blocks.size());
+
+        #pragma omp parallel for
+        for(Natural j = 0; j < blocks.size(); ++j)
+            factors[j].emplace(blocks[j]);
+
+        std::vector<Factorization<T>> result;
+        result.reserve(blocks.size());
+
+        for(auto &factor: factors)
+            result.emplace_back(std::move(*factor));
+
+        return result;
+    }
+
+    /**
+     * @brief Solves many factored systems at once.
+     * 
+     * @tparam Factorization LU, Cholesky or QR.
+     * @tparam T Numerical type.
+     * @param factors Factorizations.
+     * @param B Right-hand sides, one per factorization.
+     * @return std::vector<Vector<T>> 
+     */
+    template<template<Numerical> typename Factorization, Numerical T>
+    std::vector<Vector<T>> solve(const std::vector<Factorization<T>> &factors, const std::vector<Vector<T>> &B) {
+        #ifndef NDEBUG // Integrity check.
+        assert(factors.size() == B.size());
+        #endif
+
+        std::vector<std::optional<Vector<T>>> solutions(factors.size());
+
+        #pragma omp parallel for
+        for(Natural j = 0; j < factors.size(); ++j)
+            solutions[j].emplace(factors[j].solve(B[j]));
+
+        std::vector<Vector<T>> result;
+        result.reserve(factors.size());
+
+        for(auto &solution: solutions)
+            result.emplace_back(std::move(*solution));
+
+        return result;
+    }
+
+}
+
+#endif
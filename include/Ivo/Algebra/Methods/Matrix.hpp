@@ -61,6 +61,70 @@ namespace ivo {
             return scaled;
         }
 
+        /**
+         * @brief Complex dense solver, Gaussian elimination with partial pivoting.
+         * Row-major storage. Kept apart from LU: complex types are not Numerical,
+         * and singular pivots are perturbed as inverse iteration requires.
+         * 
+         * @tparam T Numerical type.
+         * @param A Complex matrix.
+         * @param b Complex vector.
+         * @return std::vector<std::complex<T>> 
+         */
+        template<Numerical T>
+        std::vector<std::complex<T>> c_solve(std::vector<std::complex<T>> A, std::vector<std::complex<T>> b) {
+            const Natural n = b.size();
+
+            #ifndef NDEBUG // Integrity check.
+            assert(A.size() == n * n);
+            #endif
+
+            for(Natural k = 0; k < n; ++k) {
+
+                // Pivoting.
+                Natural pivot = k;
+
+                for(Natural j = k + 1; j < n; ++j)
+                    if(std::abs(A[j * n + k]) > std::abs(A[pivot * n + k]))
+                        pivot = j;
+
+                if(pivot != k) {
+                    for(Natural h = 0; h < n; ++h)
+                        std::swap(A[k * n + h], A[pivot * n + h]);
+
+                    std::swap(b[k], b[pivot]);
+                }
+
+                // Singular pivot, perturbed.
+                if(std::abs(A[k * n + k]) <= constants::zero)
+                    A[k * n + k] = constants::algebra_zero;
+
+                // Elimination.
+                for(Natural j = k + 1; j < n; ++j) {
+                    const std::complex<T> factor = A[j * n + k] / A[k * n + k];
+
+                    for(Natural h = k; h < n; ++h)
+                        A[j * n + h] -= factor * A[k * n + h];
+
+                    b[j] -= factor * b[k];
+                }
+            }
+
+            // Backward substitution.
+            std::vector<std::complex<T>> x(n);
+
+            for(Natural j = n; j > 0; --j) {
+                std::complex<T> sum = b[j - 1];
+
+                for(Natural h = j; h < n; ++h)
+                    sum -= A[(j - 1) * n + h] * x[h];
+
+                x[j - 1] = sum / A[(j - 1) * n + j - 1];
+            }
+
+            return x;
+        }
+
     }
 
     /**
@@ -84,6 +148,202 @@ namespace ivo {
         return XY;
     }
 
+    /**
+     * @brief Real block diagonalization, A = W B W^-1.
+     * B is block diagonal, 1x1 blocks hold real eigenvalues and 2x2 blocks [a, b; -b, a]
+     * hold complex pairs a +- ib. A is assumed to be diagonalizable.
+     * Eigenvalues by shifted QR iterations, eigenvectors by inverse iteration.
+     * 
+     * @tparam T Numerical type.
+     * @param A Matrix.
+     * @return std::array<Matrix<T>, 2> 
+     */
+    template<Numerical T>
+    std::array<Matrix<T>, 2> diagonalize(const Matrix<T> &A) {
+        #ifndef NDEBUG // Integrity check.
+        assert(A.rows() == A.columns());
+        #endif
+
+        const Natural n = A.rows();
+
+        // Complex copy.
+        std::vector<std::complex<T>> H(n * n);
+
+        for(Natural j = 0; j < n; ++j)
+            for(Natural k = 0; k < n; ++k)
+                H[j * n + k] = A(j, k);
+
+        // Scale.
+        T scale = static_cast<T>(0);
+
+        for(const auto &entry: H)
+            scale = std::max(scale, std::abs(entry));
+
+        // Eigenvalues.
+        std::vector<std::complex<T>> eigenvalues;
+
+        Natural iterations = 0;
+
+        for(Natural m = n; m > 0; ) {
+
+            // Deflation.
+            T off = static_cast<T>(0);
+
+            for(Natural k = 0; k + 1 < m; ++k)
+                off += std::abs(H[(m - 1) * n + k]);
+
+            if((m == 1) || (off <= constants::algebra_zero * scale)) {
+                eigenvalues.emplace_back(H[(m - 1) * n + m - 1]);
+                --m;
+                continue;
+            }
+
+            #ifndef NDEBUG // Integrity check.
+            assert(iterations < constants::solvers_stop);
+            #endif
+
+            ++iterations;
+
+            // Wilkinson shift, trailing 2x2 block's eigenvalue closest to the last diagonal entry.
+            const std::complex<T> a = H[(m - 2) * n + m - 2], b = H[(m - 2) * n + m - 1];
+            const std::complex<T> c = H[(m - 1) * n + m - 2], d = H[(m - 1) * n + m - 1];
+
+            const std::complex<T> half_trace = (a + d) / static_cast<T>(2);
+            const std::complex<T> root = std::sqrt(half_trace * half_trace - (a * d - b * c));
+
+            std::complex<T> shift = (std::abs(half_trace + root - d) < std::abs(half_trace - root - d)) ? half_trace + root : half_trace - root;
+
+            // Exceptional shift.
+            if(iterations % 10 == 0)
+                shift += off;
+
+            // QR factorization of the active block, modified Gram-Schmidt on columns.
+            std::vector<std::complex<T>> Q(m * m), R(m * m);
+
+            for(Natural j = 0; j < m; ++j)
+                for(Natural k = 0; k < m; ++k)
+                    Q[j * m + k] = H[j * n + k] - ((j == k) ? shift : static_cast<T>(0));
+
+            for(Natural k = 0; k < m; ++k) {
+                for(Natural h = 0; h < k; ++h) {
+                    std::complex<T> product = static_cast<T>(0);
+
+                    for(Natural j = 0; j < m; ++j)
+                        product += std::conj(Q[j * m + h]) * Q[j * m + k];
+
+                    R[h * m + k] = product;
+
+                    for(Natural j = 0; j < m; ++j)
+                        Q[j * m + k] -= product * Q[j * m + h];
+                }
+
+                T column_norm = static_cast<T>(0);
+
+                for(Natural j = 0; j < m; ++j)
+                    column_norm += std::norm(Q[j * m + k]);
+
+                column_norm = std::sqrt(column_norm);
+                R[k * m + k] = column_norm;
+
+                if(column_norm > constants::zero)
+                    for(Natural j = 0; j < m; ++j)
+                        Q[j * m + k] /= column_norm;
+            }
+
+            // RQ + shift.
+            for(Natural j = 0; j < m; ++j)
+                for(Natural k = 0; k < m; ++k) {
+                    std::complex<T> product = (j == k) ? shift : static_cast<T>(0);
+
+                    for(Natural h = j; h < m; ++h)
+                        product += R[j * m + h] * Q[h * m + k];
+
+                    H[j * n + k] = product;
+                }
+        }
+
+        // Real block form.
+        Matrix<T> W{n, n};
+        Matrix<T> B{n, n};
+
+        Natural column = 0;
+
+        for(const auto &eigenvalue: eigenvalues) {
+
+            // Conjugates are covered by their pair.
+            if(eigenvalue.imag() < -std::sqrt(constants::algebra_zero) * scale)
+                continue;
+
+            const bool complex = eigenvalue.imag() > std::sqrt(constants::algebra_zero) * scale;
+
+            // Eigenvector, inverse iteration.
+            std::vector<std::complex<T>> S(n * n);
+
+            for(Natural j = 0; j < n; ++j)
+                for(Natural k = 0; k < n; ++k)
+                    S[j * n + k] = static_cast<std::complex<T>>(A(j, k)) - ((j == k) ? eigenvalue * (static_cast<T>(1) + constants::algebra_zero) : static_cast<T>(0));
+
+            std::vector<std::complex<T>> v(n, static_cast<T>(1));
+
+            for(Natural h = 0; h < 3; ++h) {
+                v = internal::c_solve<T>(S, v);
+
+                T v_norm = static_cast<T>(0);
+
+                for(const auto &entry: v)
+                    v_norm += std::norm(entry);
+
+                v_norm = std::sqrt(v_norm);
+
+                for(auto &entry: v)
+                    entry /= v_norm;
+            }
+
+            #ifndef NDEBUG // Integrity check.
+            assert(column + (complex ? 2 : 1) <= n);
+            #endif
+
+            if(complex) {
+
+                // A [a, b] = [a, b] [alpha, beta; -beta, alpha].
+                for(Natural j = 0; j < n; ++j) {
+                    W(j, column, v[j].real());
+                    W(j, column + 1, v[j].imag());
+                }
+
+                B(column, column, eigenvalue.real());
+                B(column, column + 1, eigenvalue.imag());
+                B(column + 1, column, -eigenvalue.imag());
+                B(column + 1, column + 1, eigenvalue.real());
+
+                column += 2;
+            } else {
+
+                // Real eigenvector, up to a complex phase.
+                Natural largest = 0;
+
+                for(Natural j = 1; j < n; ++j)
+                    if(std::abs(v[j]) > std::abs(v[largest]))
+                        largest = j;
+
+                const std::complex<T> phase = std::abs(v[largest]) / v[largest];
+
+                for(Natural j = 0; j < n; ++j)
+                    W(j, column, (v[j] * phase).real());
+
+                B(column, column, eigenvalue.real());
+
+                column += 1;
+            }
+        }
+
+        #ifndef NDEBUG // Integrity check.
+        assert(column == n);
+        #endif
+
+        return {W, B};
+    }
+
 }
 
 #endif
\ No newline at end of file
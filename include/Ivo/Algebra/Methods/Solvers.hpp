@@ -18,15 +18,18 @@ namespace ivo {
     namespace internal {
 
         /**
-         * @brief Restarted GMRES, solves Ax = b for x.
+         * @brief Right-preconditioned restarted GMRES, solves Ax = b for x.
          * 
          * @tparam T Numerical type.
          * @param A Sparse matrix.
          * @param b Vector.
+         * @param preconditioner Preconditioner, approximates A^-1.
+         * @param tolerance Relative tolerance, |r| < tolerance |b|.
+         * @param output Log's stream.
          * @return Vector<T> 
          */
         template<Numerical T>
-        Vector<T> gmres(Sparse<T> &A, const Vector<T> &b) {
+        Vector<T> gmres(Sparse<T> &A, const Vector<T> &b, const std::function<Vector<T> (const Vector<T> &)> &preconditioner, const Real &tolerance = 0.0L, std::ostream &output = std::cout) {
             #ifndef NDEBUG // Integrity check.
             assert(A.rows() == A.columns());
             assert(A.rows() == b.size());
@@ -42,9 +45,12 @@ namespace ivo {
             // Residual.
             Vector<T> residual = b - A * x;
 
+            // Stopping threshold.
+            const Real threshold = std::max(constants::algebra_zero, tolerance * norm(b));
+
             #ifndef NVERBOSE
-            std::cout << "\t[Solver] Restarted GMRES" << std::endl;
-            std::cout << "\t\t[Restarted GMRES] Started, residual: " << norm(residual) << std::endl;
+            output << "\t[Solver] Restarted GMRES" << std::endl;
+            output << "\t\t[Restarted GMRES] Started, residual: " << norm(residual) << std::endl;
             #endif
 
             do {
@@ -61,44 +67,30 @@ namespace ivo {
                 Vs.emplace_back(residual / residual_norm);
 
                 for(Natural j = 0; j < m; ++j) {
-                    Vector<T> w = A * Vs[j];
+                    Vector<T> w = A * preconditioner(Vs[j]);
 
                     for(Natural k = 0; k <= j; ++k) {
                         H(k, j, dot(w, Vs[k]));
-                        w -= H(k, j) * Vs[k];
+                        axpy(-H(k, j), Vs[k], w);
                     }
 
                     // New element for H.
                     H(j + 1, j, norm(w));
 
                     // New base element.
-                    Vs.emplace_back(w / H(j + 1, j));
+                    scal(static_cast<T>(1) / H(j + 1, j), w);
+                    Vs.emplace_back(std::move(w));
                 }
 
-                // Base matrix.
-                Matrix<T> V{A.rows(), m};
-
-                for(Natural j = 0; j < m; ++j)
-                    V.column(j, Vs[j]);
-
                 // Solution by least squares.
 
                 // Right-hand side.
                 Vector<T> rhs{m + 1};
                 rhs(0, residual_norm);
 
-                // Identity matrix.
-                Matrix<T> identity{m + 1, m + 1};
-
-                for(Natural j = 0; j < m + 1; ++j)
-                    identity(j, j, static_cast<T>(1));
-
                 // Rotations.
                 for(Natural j = 0; j < m; ++j) {
 
-                    // Rotation matrix.
-                    Matrix<T> rotation = identity;
-
                     // Coefficients.
                     T first = H(j, j);
                     T second = H(j + 1, j);
@@ -108,15 +100,20 @@ namespace ivo {
                     T c = first / third;
                     T s = second / third;
 
-                    // Rotation building.
-                    rotation(j, j, c);
-                    rotation(j + 1, j + 1, c);
-                    rotation(j, j + 1, s);
-                    rotation(j + 1, j, -s);
+                    // In-place rotation of rows j and j + 1.
+                    for(Natural k = 0; k < m; ++k) {
+                        T upper = H(j, k);
+                        T lower = H(j + 1, k);
+
+                        H(j, k, c * upper + s * lower);
+                        H(j + 1, k, c * lower - s * upper);
+                    }
+
+                    T upper = rhs(j);
+                    T lower = rhs(j + 1);
 
-                    // Rotation.
-                    H = rotation * H;
-                    rhs = rotation * rhs;
+                    rhs(j, c * upper + s * lower);
+                    rhs(j + 1, c * lower - s * upper);
                 }
 
                 // Backward substitution.
@@ -132,13 +129,18 @@ namespace ivo {
                 }
 
                 // Solution estimate.
-                x += V * y;
+                Vector<T> update{A.rows()};
+
+                for(Natural j = 0; j < m; ++j)
+                    axpy(y(j), Vs[j], update);
+
+                x += preconditioner(update);
 
                 // Residual re-evaluation.
                 residual = b - A * x;
 
                 // Exit conditions.
-                if(std::abs(rhs(m)) < constants::algebra_zero)
+                if(std::abs(rhs(m)) < threshold)
                     break;
 
                 // Size update.
@@ -146,23 +148,37 @@ namespace ivo {
 
                 #ifndef NVERBOSE
                 if(m == 1) {
-                    std::cout << "\t\t[Restarted GMRES] Restarting, residual: " << norm(residual) << std::endl;
+                    output << "\t\t[Restarted GMRES] Restarting, residual: " << norm(residual) << std::endl;
                     continue;
                 }
 
                 if(iterations % 25 == 0)
-                    std::cout << "\t\t[Restarted GMRES] Completed iteration " << iterations << ", residual: " << norm(residual) << std::endl;
+                    output << "\t\t[Restarted GMRES] Completed iteration " << iterations << ", residual: " << norm(residual) << std::endl;
                 #endif
 
             } while(iterations < constants::solvers_stop);
 
             #ifndef NVERBOSE
-            std::cout << "\t\t[Restarted GMRES] Exited, iterations: " << iterations << ", " << " residual: " << norm(residual) << std::endl;
+            output << "\t\t[Restarted GMRES] Exited, iterations: " << iterations << ", " << " residual: " << norm(residual) << std::endl;
             #endif
 
             return x;
         }
 
+        /**
+         * @brief Restarted GMRES, solves Ax = b for x.
+         * 
+         * @tparam T Numerical type.
+         * @param A Sparse matrix.
+         * @param b Vector.
+         * @param tolerance Relative tolerance, |r| < tolerance |b|.
+         * @return Vector<T> 
+         */
+        template<Numerical T>
+        Vector<T> gmres(Sparse<T> &A, const Vector<T> &b, const Real &tolerance = 0.0L) {
+            return internal::gmres<T>(A, b, [](const Vector<T> &x){ return x; }, tolerance);
+        }
+
     }
 
     // Solver wrapper.
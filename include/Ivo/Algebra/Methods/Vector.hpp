@@ -15,6 +15,100 @@
 
 namespace ivo {
 
+    namespace internal {
+
+        // Reductions.
+
+        /**
+         * @brief Pairwise reduction of f(j) over [begin, end).
+         * The error grows as log(end - begin), reassociation-proof unlike compensated sums.
+         * 
+         * @tparam R Result type.
+         * @tparam F Term.
+         * @tparam P Combination.
+         * @param begin First index.
+         * @param end Past-the-end index.
+         * @param f Term.
+         * @param plus Combination.
+         * @return R 
+         */
+        template<typename R, typename F, typename P>
+        R pairwise(const Natural &begin, const Natural &end, const F &f, const P &plus) {
+            if(end - begin <= constants::reduction_leaf) {
+                R result = f(begin);
+
+                for(Natural j = begin + 1; j < end; ++j)
+                    result = plus(result, f(j));
+
+                return result;
+            }
+
+            const Natural middle = begin + (end - begin) / 2;
+            return plus(pairwise<R>(begin, middle, f, plus), pairwise<R>(middle, end, f, plus));
+        }
+
+        /**
+         * @brief Parallel reduction of f(j) over [0, size), size > 0.
+         * Blocks are fixed and their partials combined pairwise in order, results do not depend on the number of threads.
+         * NDETERMINISTIC combines per-thread partials instead.
+         * 
+         * @tparam R Result type.
+         * @tparam F Term.
+         * @tparam P Combination.
+         * @param size Number of terms.
+         * @param f Term.
+         * @param plus Combination.
+         * @return R 
+         */
+        template<typename R, typename F, typename P = std::plus<>>
+        R reduce(const Natural &size, const F &f, const P &plus = P{}) {
+            #ifndef NDEBUG // Integrity check.
+            assert(size > 0);
+            #endif
+
+            const Natural block = constants::reduction_block;
+            const Natural blocks = (size + block - 1) / block;
+
+            if(blocks == 1)
+                return pairwise<R>(0, size, f, plus);
+
+            #ifndef NDETERMINISTIC
+            std::vector<R> partials(blocks);
+
+            #pragma omp parallel for
+            for(Natural b = 0; b < blocks; ++b)
+                partials[b] = pairwise<R>(b * block, std::min(size, (b + 1) * block), f, plus);
+
+            return pairwise<R>(0, blocks, [&partials](const Natural &b){ return partials[b]; }, plus);
+            #else
+            std::vector<R> partials(omp_get_max_threads());
+            std::vector<Natural> used(partials.size(), 0);
+
+            #pragma omp parallel
+            {
+                const Natural thread = omp_get_thread_num();
+
+                #pragma omp for schedule(static)
+                for(Natural b = 0; b < blocks; ++b) {
+                    const R partial = pairwise<R>(b * block, std::min(size, (b + 1) * block), f, plus);
+                    partials[thread] = used[thread] ? plus(partials[thread], partial) : partial;
+                    ++used[thread];
+                }
+            }
+
+            // Static schedule, the first thread owns the first block.
+            R result = partials[0];
+
+            for(Natural t = 1; t < partials.size(); ++t)
+                if(used[t])
+                    result = plus(result, partials[t]);
+
+            return result;
+            #endif
+        }
+
+    }
+
     /**
      * @brief Dot product.
      * 
@@ -29,13 +123,45 @@ namespace ivo {
         assert(x.size() == y.size());
         #endif
 
-        std::vector<T> x_entries = x.entries();
-        std::vector<T> y_entries = y.entries();
+        if(x.size() == 0)
+            return static_cast<T>(0);
+
+        std::span<const T> x_entries = x.data();
+        std::span<const T> y_entries = y.data();
 
         if constexpr (Conjugable<T>)
-            return std::transform_reduce(x_entries.begin(), x_entries.end(), y_entries.begin(), static_cast<T>(0), std::plus{}, [](const T &x_entry, const T &y_entry){ return x_entry * std::conj(y_entry); });
+            return internal::reduce<T>(x_entries.size(), [&x_entries, &y_entries](const Natural &j){ return x_entries[j] * std::conj(y_entries[j]); });
+        else
+            return internal::reduce<T>(x_entries.size(), [&x_entries, &y_entries](const Natural &j){ return x_entries[j] * y_entries[j]; });
+    }
+
+    /**
+     * @brief Dot product, lazy expressions.
+     * 
+     * @tparam X Operand.
+     * @tparam Y Operand.
+     * @param x Operand.
+     * @param y Operand.
+     * @return internal::Scalar<X> 
+     */
+    template<typename X, typename Y> requires internal::Compatible<X, Y> && (internal::Expression<X> || internal::Expression<Y>)
+    internal::Scalar<X> dot(const X &x, const Y &y) {
+        #ifndef NDEBUG // Integrity check.
+        assert(x.size() == y.size());
+        #endif
+
+        using T = internal::Scalar<X>;
+
+        if(x.size() == 0)
+            return static_cast<T>(0);
+
+        const internal::Node<X> x_node{x};
+        const internal::Node<Y> y_node{y};
 
-        return std::transform_reduce(x_entries.begin(), x_entries.end(), y_entries.begin(), static_cast<T>(0), std::plus{}, [](const T &x_entry, const T &y_entry){ return x_entry * y_entry; });
+        if constexpr (Conjugable<T>)
+            return internal::reduce<T>(x_node.size(), [&x_node, &y_node](const Natural &j){ return x_node(j) * std::conj(y_node(j)); });
+        else
+            return internal::reduce<T>(x_node.size(), [&x_node, &y_node](const Natural &j){ return x_node(j) * y_node(j); });
     }
 
     /**
@@ -65,10 +191,136 @@ namespace ivo {
      */
     template<Numerical T>
     Real norm(const Vector<T> &x) {
-        std::vector<T> x_entries = x.entries();
-        return std::sqrt(std::transform_reduce(x_entries.begin(), x_entries.end(), static_cast<T>(0), std::plus{}, [](const T &entry){ return std::abs(entry) * std::abs(entry); }));
+        if(x.size() == 0)
+            return 0.0L;
+
+        std::span<const T> x_entries = x.data();
+        return std::sqrt(internal::reduce<Real>(x_entries.size(), [&x_entries](const Natural &j){ return std::abs(x_entries[j]) * std::abs(x_entries[j]); }));
     }
     
+    /**
+     * @brief Vectorial norm, lazy expressions.
+     * 
+     * @tparam E Expression.
+     * @param x Expression.
+     * @return Real 
+     */
+    template<internal::Expression E>
+    Real norm(const E &x) {
+        if(x.size() == 0)
+            return 0.0L;
+
+        return std::sqrt(internal::reduce<Real>(x.size(), [&x](const Natural &j){ return std::abs(x(j)) * std::abs(x(j)); }));
+    }
+
+    /**
+     * @brief Fused dot product and norm, single pass.
+     * 
+     * @tparam T Numerical type.
+     * @param x Vector.
+     * @param y Vector.
+     * @return std::tuple<T, Real> (x, y), |x|.
+     */
+    template<Numerical T>
+    std::tuple<T, Real> dot_norm(const Vector<T> &x, const Vector<T> &y) {
+        #ifndef NDEBUG // Integrity check.
+        assert(x.size() == y.size());
+        #endif
+
+        if(x.size() == 0)
+            return {static_cast<T>(0), 0.0L};
+
+        std::span<const T> x_entries = x.data();
+        std::span<const T> y_entries = y.data();
+
+        const auto [product, squared] = internal::reduce<std::tuple<T, Real>>(x_entries.size(), [&x_entries, &y_entries](const Natural &j){
+            if constexpr (Conjugable<T>)
+                return std::tuple<T, Real>{x_entries[j] * std::conj(y_entries[j]), std::abs(x_entries[j]) * std::abs(x_entries[j])};
+            else
+                return std::tuple<T, Real>{x_entries[j] * y_entries[j], std::abs(x_entries[j]) * std::abs(x_entries[j])};
+        }, [](const std::tuple<T, Real> &first, const std::tuple<T, Real> &second){
+            return std::tuple<T, Real>{std::get<0>(first) + std::get<0>(second), std::get<1>(first) + std::get<1>(second)};
+        });
+
+        return {product, std::sqrt(squared)};
+    }
+
+    // In-place kernels.
+
+    /**
+     * @brief y <- ax + y.
+     * 
+     * @tparam T Numerical type.
+     * @param a Scalar.
+     * @param x Vector.
+     * @param y Vector, updated.
+     */
+    template<Numerical T>
+    void axpy(const T &a, const Vector<T> &x, Vector<T> &y) {
+        #ifndef NDEBUG // Integrity check.
+        assert(x.size() == y.size());
+        #endif
+
+        std::span<const T> x_entries = x.data();
+        std::span<T> y_entries = y.data();
+
+        for(Natural j = 0; j < x_entries.size(); ++j)
+            y_entries[j] += a * x_entries[j];
+    }
+
+    /**
+     * @brief y <- ax + by.
+     * 
+     * @tparam T Numerical type.
+     * @param a Scalar.
+     * @param x Vector.
+     * @param b Scalar.
+     * @param y Vector, updated.
+     */
+    template<Numerical T>
+    void axpby(const T &a, const Vector<T> &x, const T &b, Vector<T> &y) {
+        #ifndef NDEBUG // Integrity check.
+        assert(x.size() == y.size());
+        #endif
+
+        std::span<const T> x_entries = x.data();
+        std::span<T> y_entries = y.data();
+
+        for(Natural j = 0; j < x_entries.size(); ++j)
+            y_entries[j] = a * x_entries[j] + b * y_entries[j];
+    }
+
+    /**
+     * @brief x <- ax.
+     * 
+     * @tparam T Numerical type.
+     * @param a Scalar.
+     * @param x Vector, updated.
+     */
+    template<Numerical T>
+    void scal(const T &a, Vector<T> &x) {
+        std::span<T> x_entries = x.data();
+
+        for(Natural j = 0; j < x_entries.size(); ++j)
+            x_entries[j] *= a;
+    }
+
+    /**
+     * @brief y <- x, no reallocation.
+     * 
+     * @tparam T Numerical type.
+     * @param x Vector.
+     * @param y Vector, overwritten.
+     */
+    template<Numerical T>
+    void copy(const Vector<T> &x, Vector<T> &y) {
+        #ifndef NDEBUG // Integrity check.
+        assert(x.size() == y.size());
+        #endif
+
+        std::copy(x.data().begin(), x.data().end(), y.data().begin());
+    }
+
     /**
      * @brief Min{vector}.
      * 
@@ -78,8 +330,12 @@ namespace ivo {
      */
     template<Numerical T>
     T min(const Vector<T> &x) {
-        std::vector<T> x_entries = x.entries();
-        return *std::min_element(x_entries.begin(), x_entries.end());
+        #ifndef NDEBUG // Integrity check.
+        assert(x.size() > 0);
+        #endif
+
+        std::span<const T> x_entries = x.data();
+        return internal::reduce<T>(x_entries.size(), [&x_entries](const Natural &j){ return x_entries[j]; }, [](const T &first, const T &second){ return std::min(first, second); });
     }
 
     /**
@@ -91,8 +347,28 @@ namespace ivo {
      */
     template<Numerical T>
     T max(const Vector<T> &x) {
-        std::vector<T> x_entries = x.entries();
-        return *std::max_element(x_entries.begin(), x_entries.end());
+        #ifndef NDEBUG // Integrity check.
+        assert(x.size() > 0);
+        #endif
+
+        std::span<const T> x_entries = x.data();
+        return internal::reduce<T>(x_entries.size(), [&x_entries](const Natural &j){ return x_entries[j]; }, [](const T &first, const T &second){ return std::max(first, second); });
+    }
+
+    /**
+     * @brief Sum{vector}.
+     * 
+     * @tparam T Numerical type.
+     * @param x Vector.
+     * @return T 
+     */
+    template<Numerical T>
+    T sum(const Vector<T> &x) {
+        if(x.size() == 0)
+            return static_cast<T>(0);
+
+        std::span<const T> x_entries = x.data();
+        return internal::reduce<T>(x_entries.size(), [&x_entries](const Natural &j){ return x_entries[j]; });
     }
 
     
@@ -204,6 +480,16 @@ namespace std {
         return result;
     }
 
+    /**
+     * @brief Vectorial std::abs, lazy expressions.
+     * 
+     * @tparam E Expression.
+     * @param x Expression.
+     * @return ivo::internal::Unary<E, ivo::internal::Absolute> 
+     */
+    template<ivo::internal::Expression E>
+    ivo::internal::Unary<E, ivo::internal::Absolute> abs(const E &x) { return {x}; }
+
 }
 
 #endif
\ No newline at end of file
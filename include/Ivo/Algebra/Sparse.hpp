@@ -169,10 +169,22 @@ namespace ivo {
                 this->_csr = false;
                 this->_csc = false;
 
-                for(Natural j = 0; j < J.size(); ++j)
-                    for(Natural k = 0; k < K.size(); ++k)
-                        if(sparse._entries.contains(J[j] * sparse._columns + K[k]))
-                            this->_entries[j * this->_columns + k] = sparse._entries[J[j] * sparse._columns + K[k]];
+                // Column indices map.
+                std::map<Natural, Natural> columns;
+
+                for(Natural k = 0; k < K.size(); ++k)
+                    columns[K[k]] = k;
+
+                for(Natural j = 0; j < J.size(); ++j) {
+
+                    // Row's entries.
+                    auto first = sparse._entries.lower_bound(J[j] * sparse._columns);
+                    auto last = sparse._entries.lower_bound((J[j] + 1) * sparse._columns);
+
+                    for(auto entry = first; entry != last; ++entry)
+                        if(auto column = columns.find(entry->first % sparse._columns); column != columns.end())
+                            this->_entries.emplace_hint(this->_entries.end(), j * this->_columns + column->second, entry->second);
+                }
             }
 
             /**
@@ -359,6 +371,8 @@ namespace ivo {
 
                 if(std::abs(scalar) > constants::zero)
                     this->_entries[j * this->_columns + k] = scalar;
+                else
+                    this->_entries.erase(j * this->_columns + k);
             }
 
             /**
@@ -385,6 +399,8 @@ namespace ivo {
                     for(Natural k = 0; k < K.size(); ++k)
                         if(std::abs(matrix(j, k)) > constants::zero)
                             this->_entries[J[j] * this->_columns + K[k]] = matrix(j, k);
+                        else
+                            this->_entries.erase(J[j] * this->_columns + K[k]);
             }
 
             // Substructures access.
@@ -874,6 +890,8 @@ namespace ivo {
                 this->_csr_update();
 
                 Vector<T> result{this->_rows};
+
+                #pragma omp parallel for
                 for(Natural j = 0; j < this->_rows; ++j) {
                     T product = static_cast<T>(0);
 
@@ -972,19 +990,15 @@ namespace ivo {
                 this->_csr_outer.clear();
                 this->_csr_entries.clear();
 
-                for(Natural j = 0; j < this->_rows; ++j) {
-                    for(const auto &[index, entry]: this->_entries) {
-                        if(index < j * this->_columns)
-                            continue;
-
-                        if(index >= (j + 1) * this->_columns)
-                            break;
+                // Entries are sorted by row.
+                auto entry = this->_entries.begin();
 
-                        if(std::abs(entry) > constants::zero) {
-                            this->_csr_outer.emplace_back(index % this->_columns);
-                            this->_csr_entries.emplace_back(entry);
+                for(Natural j = 0; j < this->_rows; ++j) {
+                    for(; (entry != this->_entries.end()) && (entry->first < (j + 1) * this->_columns); ++entry)
+                        if(std::abs(entry->second) > constants::zero) {
+                            this->_csr_outer.emplace_back(entry->first % this->_columns);
+                            this->_csr_entries.emplace_back(entry->second);
                         }
-                    }
 
                     this->_csr_inner[j + 1] = this->_csr_outer.size();
                 }
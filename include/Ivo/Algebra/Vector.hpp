@@ -11,7 +11,7 @@
 #ifndef ALGEBRA_VECTOR
 #define ALGEBRA_VECTOR
 
-#include "./Includes.hpp"
+#include "./Expression.hpp"
 
 namespace ivo {
 
@@ -19,8 +19,9 @@ namespace ivo {
      * @brief Dynamically allocated vectors.
      * 
      * @tparam T Numerical type.
+     * @tparam N Size, fixed for N > 0 (Fixed.hpp).
      */
-    template<Numerical T>
+    template<Numerical T, Natural N>
     class Vector {
 
         private:
@@ -28,16 +29,16 @@ namespace ivo {
             // Attributes.
 
             /**
-             * @brief Vector's entries.
+             * @brief Vector's entries, from the thread's current resource.
              * 
              */
-            std::vector<T> _entries;
+            std::pmr::vector<T> _entries;
 
             /**
              * @brief Vector's size.
              * 
              */
-            const Natural _size;
+            Natural _size;
 
         public:
 
@@ -48,7 +49,21 @@ namespace ivo {
              * 
              * @return std::vector<T> 
              */
-            inline std::vector<T> entries() const { return this->_entries; }
+            inline std::vector<T> entries() const { return {this->_entries.begin(), this->_entries.end()}; }
+
+            /**
+             * @brief Vector's entries, no copy.
+             * 
+             * @return std::span<T> 
+             */
+            inline std::span<T> data() { return this->_entries; }
+
+            /**
+             * @brief Const vector's entries, no copy.
+             * 
+             * @return std::span<const T> 
+             */
+            inline std::span<const T> data() const { return this->_entries; }
 
             /**
              * @brief Vector's size.
@@ -64,7 +79,7 @@ namespace ivo {
              * 
              * @param size Vector's size.
              */
-            Vector(const Natural &size): _size{size} {
+            Vector(const Natural &size): _entries(internal::resource()), _size{size} {
                 #ifndef NDEBUG // Integrity check.
                 assert(size > 0);
                 #endif
@@ -78,7 +93,7 @@ namespace ivo {
              * @param size Vector's size.
              * @param scalar Scalar.
              */
-            Vector(const Natural &size, const T &scalar): _size{size} {
+            Vector(const Natural &size, const T &scalar): _entries(internal::resource()), _size{size} {
                 #ifndef NDEBUG // Integrity check.
                 assert(size > 0);
                 #endif
@@ -91,7 +106,7 @@ namespace ivo {
              * 
              * @param vector Standard vector.
              */
-            Vector(const std::vector<T> &vector): _size(vector.size()) {
+            Vector(const std::vector<T> &vector): _entries(internal::resource()), _size(vector.size()) {
                 #ifndef NDEBUG // Integrity check.
                 assert(vector.size() > 0);
                 #endif
@@ -105,7 +120,7 @@ namespace ivo {
              * 
              * @param vector Vector.
              */
-            Vector(const Vector &vector): _size{vector._size} {
+            Vector(const Vector &vector): _entries(internal::resource()), _size{vector._size} {
                 this->_entries.resize(vector._size, static_cast<T>(0));
                 std::copy(vector._entries.begin(), vector._entries.end(), this->_entries.begin());
             }
@@ -125,6 +140,69 @@ namespace ivo {
                 return *this;
             }
 
+            /**
+             * @brief Move constructor.
+             * 
+             * @param vector Vector.
+             */
+            Vector(Vector &&vector) noexcept: _entries{std::move(vector._entries)}, _size{vector._size} {
+                vector._entries.clear();
+                vector._size = 0;
+            }
+
+            /**
+             * @brief Move operator.
+             * 
+             * @param vector Vector.
+             * @return Vector& 
+             */
+            Vector &operator =(Vector &&vector) noexcept {
+                if(this == &vector)
+                    return *this;
+
+                this->_entries = std::move(vector._entries);
+                this->_size = vector._size;
+
+                // Valid empty source, entries are copied across different resources.
+                vector._entries.clear();
+                vector._size = 0;
+                return *this;
+            }
+
+            /**
+             * @brief Expression constructor, single evaluation loop.
+             * 
+             * @tparam E Expression.
+             * @param expression Expression.
+             */
+            template<internal::Expression E> requires std::same_as<typename E::value_type, T>
+            Vector(const E &expression): _entries(internal::resource()), _size{expression.size()} {
+                this->_entries.resize(this->_size);
+
+                for(Natural j = 0; j < this->_size; ++j)
+                    this->_entries[j] = expression(j);
+            }
+
+            /**
+             * @brief Expression operator, single evaluation loop.
+             * Element-wise expressions allow aliasing.
+             * 
+             * @tparam E Expression.
+             * @param expression Expression.
+             * @return Vector& 
+             */
+            template<internal::Expression E> requires std::same_as<typename E::value_type, T>
+            Vector &operator =(const E &expression) {
+                #ifndef NDEBUG // Integrity check.
+                assert(this->_size == expression.size());
+                #endif
+
+                for(Natural j = 0; j < this->_size; ++j)
+                    this->_entries[j] = expression(j);
+
+                return *this;
+            }
+
             // Access.
 
             /**
@@ -375,158 +453,221 @@ namespace ivo {
             Vector operator +() const { return *this; }
 
             /**
-             * @brief -Vector.
+             * @brief Vector += scalar.
              * 
-             * @return Vector
+             * @param scalar Scalar.
+             * @return Vector& 
              */
-            Vector operator -() const {
-                Vector result{this->_size};
-                std::transform(this->_entries.begin(), this->_entries.end(), result._entries.begin(), [](const T &entry){ return -entry; });
-                return result;
+            Vector &operator +=(const T &scalar) {
+                std::transform(this->_entries.begin(), this->_entries.end(), this->_entries.begin(), [scalar](const T &entry){ return entry + scalar; });
+                return *this;
             }
 
             /**
-             * @brief Vector + scalar.
+             * @brief Vector -= scalar.
              * 
              * @param scalar Scalar.
-             * @return Vector 
+             * @return Vector& 
              */
-            Vector operator +(const T &scalar) const {
-                Vector result{this->_size};
-                std::transform(this->_entries.begin(), this->_entries.end(), result._entries.begin(), [scalar](const T &entry){ return entry + scalar; });
-                return result;
+            Vector &operator -=(const T &scalar) {
+                std::transform(this->_entries.begin(), this->_entries.end(), this->_entries.begin(), [scalar](const T &entry){ return entry - scalar; });
+                return *this;
             }
 
             /**
-             * @brief Scalar + vector.
+             * @brief Vector *= scalar.
              * 
              * @param scalar Scalar.
-             * @param vector Vector.
-             * @return Vector 
+             * @return Vector& 
              */
-            friend Vector operator +(const T &scalar, const Vector &vector) {
-                Vector result{vector._size};
-                std::transform(vector._entries.begin(), vector._entries.end(), result._entries.begin(), [scalar](const T &entry){ return scalar + entry; });
-                return result;
+            Vector &operator *=(const T &scalar) {
+                std::transform(this->_entries.begin(), this->_entries.end(), this->_entries.begin(), [scalar](const T &entry){ return entry * scalar; });
+                return *this;
             }
 
             /**
-             * @brief Vector += scalar.
+             * @brief Vector /= scalar.
              * 
              * @param scalar Scalar.
              * @return Vector& 
              */
-            Vector &operator +=(const T &scalar) {
-                std::transform(this->_entries.begin(), this->_entries.end(), this->_entries.begin(), [scalar](const T &entry){ return entry + scalar; });
+            Vector &operator /=(const T &scalar) {
+                std::transform(this->_entries.begin(), this->_entries.end(), this->_entries.begin(), [scalar](const T &entry){ return entry / scalar; });
                 return *this;
             }
 
             /**
-             * @brief Vector - scalar.
+             * @brief Vector += vector.
              * 
-             * @param scalar Scalar.
-             * @return Vector 
+             * @param vector 
+             * @return Vector& 
              */
-            Vector operator -(const T &scalar) const {
-                Vector result{this->_size};
-                std::transform(this->_entries.begin(), this->_entries.end(), result._entries.begin(), [scalar](const T &entry){ return entry - scalar; });
-                return result;
+            Vector &operator +=(const Vector &vector) {
+                #ifndef NDEBUG // Integrity check.
+                assert(this->_size == vector._size);
+                #endif
+
+                std::transform(this->_entries.begin(), this->_entries.end(), vector._entries.begin(), this->_entries.begin(), [](T &t_entry, const T &v_entry){ return t_entry + v_entry; });
+                return *this;
             }
 
             /**
-             * @brief Scalar - vector.
+             * @brief Vector -= vector.
              * 
-             * @param scalar Scalar.
-             * @param vector Vector.
-             * @return Vector 
+             * @param vector 
+             * @return Vector& 
              */
-            friend Vector operator -(const T &scalar, const Vector &vector) {
-                Vector result{vector._size};
-                std::transform(vector._entries.begin(), vector._entries.end(), result._entries.begin(), [scalar](const T &entry){ return scalar - entry; });
-                return result;
+            Vector &operator -=(const Vector &vector) {
+                #ifndef NDEBUG // Integrity check.
+                assert(this->_size == vector._size);
+                #endif
+
+                std::transform(this->_entries.begin(), this->_entries.end(), vector._entries.begin(), this->_entries.begin(), [](T &t_entry, const T &v_entry){ return t_entry - v_entry; });
+                return *this;
             }
 
             /**
-             * @brief Vector -= scalar.
+             * @brief Vector *= vector (element-wise).
              * 
-             * @param scalar Scalar.
+             * @param vector 
              * @return Vector& 
              */
-            Vector &operator -=(const T &scalar) {
-                std::transform(this->_entries.begin(), this->_entries.end(), this->_entries.begin(), [scalar](const T &entry){ return entry - scalar; });
+            Vector &operator *=(const Vector &vector) {
+                #ifndef NDEBUG // Integrity check.
+                assert(this->_size == vector._size);
+                #endif
+
+                std::transform(this->_entries.begin(), this->_entries.end(), vector._entries.begin(), this->_entries.begin(), [](T &t_entry, const T &v_entry){ return t_entry * v_entry; });
                 return *this;
             }
 
             /**
-             * @brief Vector * scalar.
+             * @brief Vector /= vector (element-wise).
              * 
-             * @param scalar Scalar.
-             * @return Vector 
+             * @param vector 
+             * @return Vector& 
              */
-            Vector operator *(const T &scalar) const {
-                Vector result{this->_size};
-                std::transform(this->_entries.begin(), this->_entries.end(), result._entries.begin(), [scalar](const T &entry){ return entry * scalar; });
-                return result;
+            Vector &operator /=(const Vector &vector) {
+                #ifndef NDEBUG // Integrity check.
+                assert(this->_size == vector._size);
+                #endif
+
+                std::transform(this->_entries.begin(), this->_entries.end(), vector._entries.begin(), this->_entries.begin(), [](T &t_entry, const T &v_entry){ return t_entry / v_entry; });
+                return *this;
             }
 
             /**
-             * @brief Scalar * vector.
+             * @brief Vector += expression.
              * 
-             * @param scalar Scalar.
-             * @param vector Vector.
-             * @return Vector 
+             * @tparam E Expression.
+             * @param expression Expression.
+             * @return Vector& 
              */
-            friend Vector operator *(const T &scalar, const Vector &vector) {
-                Vector result{vector._size};
-                std::transform(vector._entries.begin(), vector._entries.end(), result._entries.begin(), [scalar](const T &entry){ return scalar * entry; });
-                return result;
+            template<internal::Expression E> requires std::same_as<typename E::value_type, T>
+            Vector &operator +=(const E &expression) {
+                #ifndef NDEBUG // Integrity check.
+                assert(this->_size == expression.size());
+                #endif
+
+                for(Natural j = 0; j < this->_size; ++j)
+                    this->_entries[j] += expression(j);
+
+                return *this;
             }
 
             /**
-             * @brief Vector *= scalar.
+             * @brief Vector -= expression.
              * 
-             * @param scalar Scalar.
+             * @tparam E Expression.
+             * @param expression Expression.
              * @return Vector& 
              */
-            Vector &operator *=(const T &scalar) {
-                std::transform(this->_entries.begin(), this->_entries.end(), this->_entries.begin(), [scalar](const T &entry){ return entry * scalar; });
+            template<internal::Expression E> requires std::same_as<typename E::value_type, T>
+            Vector &operator -=(const E &expression) {
+                #ifndef NDEBUG // Integrity check.
+                assert(this->_size == expression.size());
+                #endif
+
+                for(Natural j = 0; j < this->_size; ++j)
+                    this->_entries[j] -= expression(j);
+
                 return *this;
             }
 
             /**
-             * @brief Vector / scalar.
+             * @brief Vector *= expression.
              * 
-             * @param scalar Scalar.
-             * @return Vector 
+             * @tparam E Expression.
+             * @param expression Expression.
+             * @return Vector& 
              */
-            Vector operator /(const T &scalar) const {
+            template<internal::Expression E> requires std::same_as<typename E::value_type, T>
+            Vector &operator *=(const E &expression) {
+                #ifndef NDEBUG // Integrity check.
+                assert(this->_size == expression.size());
+                #endif
+
+                for(Natural j = 0; j < this->_size; ++j)
+                    this->_entries[j] *= expression(j);
+
+                return *this;
+            }
+
+            /**
+             * @brief Vector /= expression.
+             * 
+             * @tparam E Expression.
+             * @param expression Expression.
+             * @return Vector& 
+             */
+            template<internal::Expression E> requires std::same_as<typename E::value_type, T>
+            Vector &operator /=(const E &expression) {
+                #ifndef NDEBUG // Integrity check.
+                assert(this->_size == expression.size());
+                #endif
+
+                for(Natural j = 0; j < this->_size; ++j)
+                    this->_entries[j] /= expression(j);
+
+                return *this;
+            }
+
+            #ifdef NLAZY // Eager operations, debugging.
+
+            /**
+             * @brief -Vector.
+             * 
+             * @return Vector
+             */
+            Vector operator -() const {
                 Vector result{this->_size};
-                std::transform(this->_entries.begin(), this->_entries.end(), result._entries.begin(), [scalar](const T &entry){ return entry / scalar; });
+                std::transform(this->_entries.begin(), this->_entries.end(), result._entries.begin(), [](const T &entry){ return -entry; });
                 return result;
             }
 
             /**
-             * @brief Scalar / vector.
+             * @brief Vector + scalar.
              * 
              * @param scalar Scalar.
-             * @param vector Vector.
              * @return Vector 
              */
-            friend Vector operator /(const T &scalar, const Vector &vector) {
-                Vector result{vector._size};
-                std::transform(vector._entries.begin(), vector._entries.end(), result._entries.begin(), [scalar](const T &entry){ return scalar / entry; });
+            Vector operator +(const T &scalar) const {
+                Vector result{this->_size};
+                std::transform(this->_entries.begin(), this->_entries.end(), result._entries.begin(), [scalar](const T &entry){ return entry + scalar; });
                 return result;
             }
 
             /**
-             * @brief Vector /= scalar.
+             * @brief Scalar + vector.
              * 
              * @param scalar Scalar.
-             * @return Vector& 
+             * @param vector Vector.
+             * @return Vector 
              */
-            Vector &operator /=(const T &scalar) {
-                std::transform(this->_entries.begin(), this->_entries.end(), this->_entries.begin(), [scalar](const T &entry){ return entry / scalar; });
-                return *this;
+            friend Vector operator +(const T &scalar, const Vector &vector) {
+                Vector result{vector._size};
+                std::transform(vector._entries.begin(), vector._entries.end(), result._entries.begin(), [scalar](const T &entry){ return scalar + entry; });
+                return result;
             }
 
             /**
@@ -546,18 +687,28 @@ namespace ivo {
             }
 
             /**
-             * @brief Vector += vector.
+             * @brief Vector - scalar.
              * 
-             * @param vector 
-             * @return Vector& 
+             * @param scalar Scalar.
+             * @return Vector 
              */
-            Vector &operator +=(const Vector &vector) {
-                #ifndef NDEBUG // Integrity check.
-                assert(this->_size == vector._size);
-                #endif
+            Vector operator -(const T &scalar) const {
+                Vector result{this->_size};
+                std::transform(this->_entries.begin(), this->_entries.end(), result._entries.begin(), [scalar](const T &entry){ return entry - scalar; });
+                return result;
+            }
 
-                std::transform(this->_entries.begin(), this->_entries.end(), vector._entries.begin(), this->_entries.begin(), [](T &t_entry, const T &v_entry){ return t_entry + v_entry; });
-                return *this;
+            /**
+             * @brief Scalar - vector.
+             * 
+             * @param scalar Scalar.
+             * @param vector Vector.
+             * @return Vector 
+             */
+            friend Vector operator -(const T &scalar, const Vector &vector) {
+                Vector result{vector._size};
+                std::transform(vector._entries.begin(), vector._entries.end(), result._entries.begin(), [scalar](const T &entry){ return scalar - entry; });
+                return result;
             }
 
             /**
@@ -577,18 +728,28 @@ namespace ivo {
             }
 
             /**
-             * @brief Vector -= vector.
+             * @brief Vector * scalar.
              * 
-             * @param vector 
-             * @return Vector& 
+             * @param scalar Scalar.
+             * @return Vector 
              */
-            Vector &operator -=(const Vector &vector) {
-                #ifndef NDEBUG // Integrity check.
-                assert(this->_size == vector._size);
-                #endif
+            Vector operator *(const T &scalar) const {
+                Vector result{this->_size};
+                std::transform(this->_entries.begin(), this->_entries.end(), result._entries.begin(), [scalar](const T &entry){ return entry * scalar; });
+                return result;
+            }
 
-                std::transform(this->_entries.begin(), this->_entries.end(), vector._entries.begin(), this->_entries.begin(), [](T &t_entry, const T &v_entry){ return t_entry - v_entry; });
-                return *this;
+            /**
+             * @brief Scalar * vector.
+             * 
+             * @param scalar Scalar.
+             * @param vector Vector.
+             * @return Vector 
+             */
+            friend Vector operator *(const T &scalar, const Vector &vector) {
+                Vector result{vector._size};
+                std::transform(vector._entries.begin(), vector._entries.end(), result._entries.begin(), [scalar](const T &entry){ return scalar * entry; });
+                return result;
             }
 
             /**
@@ -608,18 +769,28 @@ namespace ivo {
             }
 
             /**
-             * @brief Vector *= vector (element-wise).
+             * @brief Vector / scalar.
              * 
-             * @param vector 
-             * @return Vector& 
+             * @param scalar Scalar.
+             * @return Vector 
              */
-            Vector &operator *=(const Vector &vector) {
-                #ifndef NDEBUG // Integrity check.
-                assert(this->_size == vector._size);
-                #endif
+            Vector operator /(const T &scalar) const {
+                Vector result{this->_size};
+                std::transform(this->_entries.begin(), this->_entries.end(), result._entries.begin(), [scalar](const T &entry){ return entry / scalar; });
+                return result;
+            }
 
-                std::transform(this->_entries.begin(), this->_entries.end(), vector._entries.begin(), this->_entries.begin(), [](T &t_entry, const T &v_entry){ return t_entry * v_entry; });
-                return *this;
+            /**
+             * @brief Scalar / vector.
+             * 
+             * @param scalar Scalar.
+             * @param vector Vector.
+             * @return Vector 
+             */
+            friend Vector operator /(const T &scalar, const Vector &vector) {
+                Vector result{vector._size};
+                std::transform(vector._entries.begin(), vector._entries.end(), result._entries.begin(), [scalar](const T &entry){ return scalar / entry; });
+                return result;
             }
 
             /**
@@ -638,20 +809,7 @@ namespace ivo {
                 return result;
             }
 
-            /**
-             * @brief Vector /= vector (element-wise).
-             * 
-             * @param vector 
-             * @return Vector& 
-             */
-            Vector &operator /=(const Vector &vector) {
-                #ifndef NDEBUG // Integrity check.
-                assert(this->_size == vector._size);
-                #endif
-
-                std::transform(this->_entries.begin(), this->_entries.end(), vector._entries.begin(), this->_entries.begin(), [](T &t_entry, const T &v_entry){ return t_entry / v_entry; });
-                return *this;
-            }
+            #endif
 
             // Output.
 
@@ -43,6 +43,12 @@ namespace ivo {
          */
         constexpr Real quadrature_zero = 1E-14;
 
+        /**
+         * @brief Kronecker structure relative tolerance.
+         * 
+         */
+        constexpr Real kronecker_zero = 1E-12;
+
         // Diagrams.
 
         /**
@@ -65,6 +71,44 @@ namespace ivo {
          */
         constexpr Natural quadrature = 5;
 
+        /**
+         * @brief Highest tabulated quadrature order.
+         * 
+         */
+        constexpr Natural quadrature_max = 63;
+
+        /**
+         * @brief Triangle quadrature exactness degree, as the collapsed rule of order quadrature.
+         * 
+         */
+        constexpr Natural quadrature_degree = 2 * quadrature - 2;
+
+        /**
+         * @brief Default extra quadrature degree for coefficients and data.
+         * 
+         */
+        constexpr Natural coefficient_degree = 4;
+
+        /**
+         * @brief Symmetric rules' refinement iterations.
+         * 
+         */
+        constexpr Natural symmetric_iterations = 16;
+
+        // Basis.
+
+        /**
+         * @brief Per-element orthonormalized space basis, diagonal mass matrices.
+         * 
+         */
+        constexpr bool orthonormal = false;
+
+        /**
+         * @brief Basis tabulations' cache cap, bytes.
+         * 
+         */
+        constexpr Natural tabulation_cap = 1 << 28;
+
         // Solvers.
 
         /**
@@ -79,6 +123,80 @@ namespace ivo {
          */
         constexpr Natural gmres_restart = 2E2;
 
+        /**
+         * @brief Solvers' relative tolerance.
+         * 
+         */
+        constexpr Real solvers_tolerance = 1E-10;
+
+        /**
+         * @brief Solvers' safety factor over the a-posteriori estimate.
+         * 
+         */
+        constexpr Real solvers_safety = 1E-2;
+
+        /**
+         * @brief All-at-once solver's window, time slabs.
+         * 
+         */
+        constexpr Natural window = 8;
+
+        // Multigrid.
+
+        /**
+         * @brief Multigrid smoothing steps.
+         * 
+         */
+        constexpr Natural multigrid_smoothing = 2;
+
+        /**
+         * @brief Multigrid direct coarse solver threshold.
+         * 
+         */
+        constexpr Natural multigrid_coarse = 5E2;
+
+        // Dense kernels.
+
+        /**
+         * @brief Dense products' cache block.
+         * 
+         */
+        constexpr Natural dense_block = 64;
+
+        /**
+         * @brief Dense products' unblocked threshold.
+         * 
+         */
+        constexpr Natural dense_small = 64;
+
+        /**
+         * @brief Highest space and time degrees with compile-time element kernels.
+         * 
+         */
+        constexpr Natural kernel_degree = 5;
+
+        // Reductions.
+
+        /**
+         * @brief Pairwise reductions' sequential leaf.
+         * 
+         */
+        constexpr Natural reduction_leaf = 32;
+
+        /**
+         * @brief Reductions' block, fixed across thread counts.
+         * 
+         */
+        constexpr Natural reduction_block = 4096;
+
+        // Memory.
+
+        /**
+         * @brief Arena's chunk size, bytes.
+         * 
+         */
+        constexpr Natural arena_chunk = 1 << 20;
+
     }
 
 }
@@ -21,4 +21,10 @@
 // Quadrature.
 #include "./Fem/Quadrature.hpp"
 
+// Space-time integrals.
+#include "./Fem/Integrals.hpp"
+
+// Exact polynomial integrals.
+#include "./Fem/Monomials.hpp"
+
 #endif
\ No newline at end of file
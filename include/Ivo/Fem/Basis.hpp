@@ -23,6 +23,22 @@ namespace ivo {
         std::tuple<std::array<Vector<Real>, 2>, Real> reference_to_element(const Mesh21 &, const Natural &, const Natural &, const std::array<Vector<Real>, 2> &);
         std::tuple<std::array<Vector<Real>, 2>, Vector<Real>, Real> reference_to_element(const Mesh21 &, const Natural &, const Natural &, const Vector<Real> &);
 
+        // Space basis, bounding box and change of basis.
+
+        std::array<Matrix<Real>, 3> box_basis_xy(const Mesh21 &, const Natural &, const std::array<Vector<Real>, 2> &);
+        Matrix<Real> orthonormalization(const Mesh21 &, const Natural &);
+
+        // Cached space basis tabulations.
+
+        std::array<Matrix<Real>, 3> tabulation(const std::vector<Real> &, const std::function<std::array<Matrix<Real>, 3> ()> &);
+        std::array<Matrix<Real>, 3> tabulated_xy(const Mesh21 &, const Natural &, const Natural &);
+        std::array<Matrix<Real>, 3> tabulated_xy(const Mesh21 &, const Natural &, const Natural &, const Natural &, const Natural &);
+
+        // Reference time matrices.
+
+        const std::array<Matrix<Real>, 3> &time_matrices(const Natural &);
+        const std::array<Vector<Real>, 2> &time_traces(const Natural &);
+
     }
 
     // Basis functions.
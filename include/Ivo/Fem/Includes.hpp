@@ -15,6 +15,14 @@
 #include <array>
 #include <tuple>
 
+// Compile-time kernels.
+#include <utility>
+
+// Caches.
+#include <mutex>
+#include <list>
+#include <functional>
+
 // Base, Algebra and Mesh21.
 #include "../Base.hpp"
 #include "../Algebra.hpp"
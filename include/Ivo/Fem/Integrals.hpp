@@ -0,0 +1,35 @@
+/**
+ * @file Integrals.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Sum-factorized space-time integrals.
+ * @date 2024-11-03
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef FEM_INTEGRALS
+#define FEM_INTEGRALS
+
+#include "./Includes.hpp"
+
+namespace ivo {
+
+    namespace internal {
+
+        // Space-time products' integrals.
+
+        Matrix<Real> kronecker(const Matrix<Real> &, const Matrix<Real> &);
+        Matrix<Real> weighted(const Matrix<Real> &, const Vector<Real> &, const Matrix<Real> &);
+        Matrix<Real> factorized(const Matrix<Real> &, const Matrix<Real> &, const Vector<Real> &, const Matrix<Real> &, const Matrix<Real> &, const Vector<Real> &);
+        Matrix<Real> factorized(const Matrix<Real> &, const Matrix<Real> &, const Vector<Real> &, const Matrix<Real> &, const Matrix<Real> &, const Vector<Real> &, const Matrix<Real> &);
+
+        // Space-time evaluations.
+
+        Matrix<Real> evaluated(const Matrix<Real> &, const Matrix<Real> &, const Vector<Real> &);
+
+    }
+
+}
+
+#endif
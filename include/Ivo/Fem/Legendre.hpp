@@ -20,6 +20,8 @@ namespace ivo {
     namespace internal {
 
         Vector<Real> legendre(const Vector<Real> &, const Natural &, const Natural &k = 0);
+        std::array<Matrix<Real>, 2> legendres(const Vector<Real> &, const Natural &);
+        Matrix<Real> legendre_monomials(const Natural &);
 
     }
 
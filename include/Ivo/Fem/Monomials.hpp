@@ -0,0 +1,39 @@
+/**
+ * @file Monomials.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Exact polynomial integrals over polygons and edges.
+ * @date 2024-11-05
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef FEM_MONOMIALS
+#define FEM_MONOMIALS
+
+#include "./Includes.hpp"
+
+namespace ivo {
+
+    namespace internal {
+
+        // Affine polynomials' powers.
+
+        std::vector<std::vector<Real>> powers(const Real &, const Real &, const Natural &);
+
+        // Space basis' monomial coefficients.
+
+        std::array<Matrix<Real>, 3> monomials_xy(const Mesh21 &, const Natural &);
+        std::array<Matrix<Real>, 3> monomials_edge(const Mesh21 &, const Natural &, const Natural &, const Natural &);
+
+        // Moments and exact products' integrals.
+
+        Matrix<Real> moments_xy(const Mesh21 &, const Natural &, const Natural &);
+        Matrix<Real> exact_xy(const Matrix<Real> &, const Matrix<Real> &, const Matrix<Real> &);
+        Matrix<Real> exact_edge(const Real &, const Matrix<Real> &, const Matrix<Real> &);
+
+    }
+
+}
+
+#endif
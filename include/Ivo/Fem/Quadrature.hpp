@@ -20,14 +20,31 @@ namespace ivo {
         // Gauss-Legendre nodes and weights.
     
         std::array<Vector<Real>, 2> gauss1(const Natural &, const Real &, const Real &);
+        std::array<Vector<Real>, 3> gauss2(const Natural &);
+
+        // Orders by exactness degree.
+
+        Natural order(const Natural &);
 
     }
 
     // Gauss-Legendre nodes and weights over reference structures.
 
-    std::array<Vector<Real>, 2> quadrature1t(const Natural &);
-    std::array<Vector<Real>, 2> quadrature1x(const Natural &);
-    std::array<Vector<Real>, 3> quadrature2xy(const Natural &);
+    const std::array<Vector<Real>, 2> &quadrature1t(const Natural &);
+    const std::array<Vector<Real>, 2> &quadrature1x(const Natural &);
+    const std::array<Vector<Real>, 3> &quadrature2xy(const Natural &);
+
+    // Symmetric nodes and weights over the reference triangle.
+
+    const std::array<Vector<Real>, 3> &symmetric2xy(const Natural &);
+
+    namespace internal {
+
+        // Polygon-native nodes and weights.
+
+        std::tuple<std::array<Vector<Real>, 2>, Vector<Real>> polygon_quadrature(const Mesh21 &, const Natural &, const Natural &);
+
+    }
 
 }
 
@@ -56,6 +56,7 @@ namespace ivo {
             // Conversions.
 
             operator Vector<Real>() const;
+            operator Vector<Real, 3>() const;
 
             // Comparison.
 
@@ -25,4 +25,7 @@
 // Neighbours.
 #include "./Mesh21/Neighbour21.hpp"
 
+// Cells' geometry.
+#include "./Mesh21/Cell21.hpp"
+
 #endif
\ No newline at end of file
@@ -0,0 +1,180 @@
+/**
+ * @file Cell21.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Space cells' geometry.
+ * @date 2024-11-04
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef MESH21_CELL21
+#define MESH21_CELL21
+
+#include "./Includes.hpp"
+
+namespace ivo {
+
+    /**
+     * @brief Cell21. Space cell's geometry, shared by the elements over the cell.
+     * Affine maps are stored by component, one entry per sub-triangle or edge.
+     * 
+     */
+    class Cell21 {
+
+        private:
+
+            // Attributes.
+
+            /**
+             * @brief Vertices' coordinates, x_0, y_0, x_1, y_1, ...
+             * 
+             */
+            std::vector<Real> _vertices;
+
+            /**
+             * @brief Sub-triangles' Jacobians, by component.
+             * 
+             */
+            std::array<std::vector<Real>, 4> _jacobians;
+
+            /**
+             * @brief Sub-triangles' translations, by component.
+             * 
+             */
+            std::array<std::vector<Real>, 2> _translations;
+
+            /**
+             * @brief Sub-triangles' Jacobians' determinants.
+             * 
+             */
+            std::vector<Real> _determinants;
+
+            /**
+             * @brief Edges' origins, by component.
+             * 
+             */
+            std::array<std::vector<Real>, 2> _origins;
+
+            /**
+             * @brief Edges' directions, by component.
+             * 
+             */
+            std::array<std::vector<Real>, 2> _directions;
+
+            /**
+             * @brief Edges' unit outward normals, by component.
+             * 
+             */
+            std::array<std::vector<Real>, 2> _normals;
+
+            /**
+             * @brief Edges' lengths.
+             * 
+             */
+            std::vector<Real> _lengths;
+
+            /**
+             * @brief Bounding box's centre and half sizes, x_c, y_c, h_x, h_y.
+             * 
+             */
+            std::array<Real, 4> _box;
+
+        public:
+
+            // Attributes access.
+
+            /**
+             * @brief Vertices' coordinates, x_0, y_0, x_1, y_1, ...
+             * 
+             * @return const std::vector<Real>& 
+             */
+            inline const std::vector<Real> &vertices() const { return this->_vertices; }
+
+            /**
+             * @brief Number of sub-triangles.
+             * 
+             * @return Natural 
+             */
+            inline Natural triangles() const { return this->_determinants.size(); }
+
+            /**
+             * @brief Sub-triangle's Jacobian, J_00, J_01, J_10, J_11.
+             * 
+             * @param k Sub-triangle's index.
+             * @return std::array<Real, 4> 
+             */
+            inline std::array<Real, 4> jacobian(const Natural &k) const {
+                return {this->_jacobians[0][k], this->_jacobians[1][k], this->_jacobians[2][k], this->_jacobians[3][k]};
+            }
+
+            /**
+             * @brief Sub-triangle's translation.
+             * 
+             * @param k Sub-triangle's index.
+             * @return std::array<Real, 2> 
+             */
+            inline std::array<Real, 2> translation(const Natural &k) const { return {this->_translations[0][k], this->_translations[1][k]}; }
+
+            /**
+             * @brief Sub-triangle's Jacobian's determinant.
+             * 
+             * @param k Sub-triangle's index.
+             * @return Real 
+             */
+            inline Real determinant(const Natural &k) const { return this->_determinants[k]; }
+
+            /**
+             * @brief Number of edges.
+             * 
+             * @return Natural 
+             */
+            inline Natural edges() const { return this->_lengths.size(); }
+
+            /**
+             * @brief Edge's origin.
+             * 
+             * @param k Edge's index.
+             * @return std::array<Real, 2> 
+             */
+            inline std::array<Real, 2> origin(const Natural &k) const { return {this->_origins[0][k], this->_origins[1][k]}; }
+
+            /**
+             * @brief Edge's direction, end minus origin.
+             * 
+             * @param k Edge's index.
+             * @return std::array<Real, 2> 
+             */
+            inline std::array<Real, 2> direction(const Natural &k) const { return {this->_directions[0][k], this->_directions[1][k]}; }
+
+            /**
+             * @brief Edge's unit outward normal.
+             * 
+             * @param k Edge's index.
+             * @return std::array<Real, 2> 
+             */
+            inline std::array<Real, 2> normal(const Natural &k) const { return {this->_normals[0][k], this->_normals[1][k]}; }
+
+            /**
+             * @brief Edge's length.
+             * 
+             * @param k Edge's index.
+             * @return Real 
+             */
+            inline Real length(const Natural &k) const { return this->_lengths[k]; }
+
+            /**
+             * @brief Bounding box's centre and half sizes, x_c, y_c, h_x, h_y.
+             * 
+             * @return std::array<Real, 4> 
+             */
+            inline std::array<Real, 4> box() const { return this->_box; }
+
+            // Constructors.
+
+            Cell21(const Polygon21 &);
+    };
+
+}
+
+#endif
@@ -13,6 +13,7 @@
 
 #include "./Element21.hpp"
 #include "./Neighbour21.hpp"
+#include "./Cell21.hpp"
 
 namespace ivo {
 
@@ -51,6 +52,18 @@ namespace ivo {
              */
             std::vector<Neighbour21> _neighbours;
 
+            /**
+             * @brief Space cells' geometry.
+             * 
+             */
+            std::vector<Cell21> _cells;
+
+            /**
+             * @brief Time intervals' endpoints.
+             * 
+             */
+            std::vector<Real> _intervals;
+
         public:
 
             // Attributes access.
@@ -79,9 +92,9 @@ namespace ivo {
              * @brief Scalar element access.
              * 
              * @param j Element index.
-             * @return Element21 
+             * @return const Element21& 
              */
-            inline Element21 element(const Natural &j) const {
+            inline const Element21 &element(const Natural &j) const {
                 #ifndef NDEBUG
                 assert(j < this->_space * this->_time);
                 #endif
@@ -93,9 +106,9 @@ namespace ivo {
              * @brief Scalar neighbour access.
              * 
              * @param j Neighbour index.
-             * @return Neighbour21 
+             * @return const Neighbour21& 
              */
-            inline Neighbour21 neighbour(const Natural &j) const {
+            inline const Neighbour21 &neighbour(const Natural &j) const {
                 #ifndef NDEBUG
                 assert(j < this->_space * this->_time);
                 #endif
@@ -103,6 +116,36 @@ namespace ivo {
                 return this->_neighbours[j];
             }
 
+            // Geometry access.
+
+            /**
+             * @brief Element's space cell geometry.
+             * 
+             * @param j Element index.
+             * @return const Cell21& 
+             */
+            inline const Cell21 &cell(const Natural &j) const {
+                #ifndef NDEBUG
+                assert(j < this->_space * this->_time);
+                #endif
+
+                return this->_cells[j % this->_space];
+            }
+
+            /**
+             * @brief Element's time interval.
+             * 
+             * @param j Element index.
+             * @return std::array<Real, 2> 
+             */
+            inline std::array<Real, 2> interval(const Natural &j) const {
+                #ifndef NDEBUG
+                assert(j < this->_space * this->_time);
+                #endif
+
+                return {this->_intervals[j / this->_space], this->_intervals[j / this->_space + 1]};
+            }
+
             // Parameters.
 
             Natural dofs() const;
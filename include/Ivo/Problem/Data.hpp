@@ -43,6 +43,12 @@ namespace ivo {
              */
             const std::function<Real (Real, Real, Real)> _neumann;
 
+            /**
+             * @brief Data's extra quadrature degree.
+             * 
+             */
+            const Natural _degree;
+
         public:
 
             // Attributes access.
@@ -83,9 +89,16 @@ namespace ivo {
                 return this->_neumann(x, y, t);
             }
 
+            /**
+             * @brief Data's extra quadrature degree, added to the polynomial degree of the integrands.
+             * 
+             * @return constexpr Natural 
+             */
+            constexpr Natural degree() const { return this->_degree; }
+
             // Constructor.
 
-            Data(const std::function<Real (Real, Real, Real)> &, const std::function<Real (Real, Real, Real)> &, const std::function<Real (Real, Real, Real)> &);
+            Data(const std::function<Real (Real, Real, Real)> &, const std::function<Real (Real, Real, Real)> &, const std::function<Real (Real, Real, Real)> &, const Natural & = constants::coefficient_degree);
 
     };
 
@@ -43,6 +43,12 @@ namespace ivo {
              */
             const std::function<Real (Real, Real, Real)> _reaction;
 
+            /**
+             * @brief Coefficients' extra quadrature degree.
+             * 
+             */
+            const Natural _degree;
+
         public:
 
             // Attributes access.
@@ -71,9 +77,23 @@ namespace ivo {
              */
             constexpr Real reaction(const Real &x, const Real &y, const Real &t) const { return this->_reaction(x, y, t); }
 
+            /**
+             * @brief Coefficients' extra quadrature degree, added to the polynomial degree of the integrands.
+             * 
+             * @return constexpr Natural 
+             */
+            constexpr Natural degree() const { return this->_degree; }
+
+            /**
+             * @brief Constant coefficients, declared by a zero extra degree.
+             * 
+             * @return constexpr bool 
+             */
+            constexpr bool constant() const { return this->_degree == 0; }
+
             // Constructor.
 
-            Equation(const std::function<std::array<Real, 2> (Real, Real, Real)> &, const Real &, const std::function<Real (Real, Real, Real)> &);
+            Equation(const std::function<std::array<Real, 2> (Real, Real, Real)> &, const Real &, const std::function<Real (Real, Real, Real)> &, const Natural & = constants::coefficient_degree);
 
     };
 
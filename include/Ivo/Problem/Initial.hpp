@@ -31,6 +31,12 @@ namespace ivo {
              */
             const std::function<Real (Real, Real)> _condition;
 
+            /**
+             * @brief Condition's extra quadrature degree.
+             * 
+             */
+            const Natural _degree;
+
         public:
 
             // Access.
@@ -48,9 +54,16 @@ namespace ivo {
 
             Vector<Real> operator ()(const Vector<Real> &, const Vector<Real> &) const;
 
+            /**
+             * @brief Condition's extra quadrature degree, added to the polynomial degree of the integrands.
+             * 
+             * @return constexpr Natural 
+             */
+            constexpr Natural degree() const { return this->_degree; }
+
             // Constructor.
 
-            Initial(const std::function<Real (Real, Real)> &);
+            Initial(const std::function<Real (Real, Real)> &, const Natural & = constants::coefficient_degree);
 
     };
 
@@ -0,0 +1,107 @@
+/**
+ * @file Multigrid.hpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief p-multigrid preconditioner.
+ * @date 2024-10-21
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#ifndef PROBLEM_MULTIGRID
+#define PROBLEM_MULTIGRID
+
+#include "./Includes.hpp"
+
+namespace ivo {
+
+    /**
+     * @brief p-multigrid preconditioner for a time slab's system.
+     * The modal basis is hierarchical, levels are obtained by lowering each element's
+     * degrees by one, (p, q) -> (p - 1, q - 1), down to (0, 0).
+     * 
+     */
+    class Multigrid {
+
+        private:
+
+            // Attributes.
+
+            /**
+             * @brief Levels' blocks (elements) offsets.
+             * 
+             */
+            std::vector<std::vector<Natural>> _blocks;
+
+            /**
+             * @brief Levels' CSR inner vectors.
+             * 
+             */
+            std::vector<std::vector<Natural>> _inner;
+
+            /**
+             * @brief Levels' CSR outer vectors.
+             * 
+             */
+            std::vector<std::vector<Natural>> _outer;
+
+            /**
+             * @brief Levels' CSR entries vectors.
+             * 
+             */
+            std::vector<std::vector<Real>> _entries;
+
+            /**
+             * @brief Levels' diagonal blocks factorizations, block smoother.
+             * 
+             */
+            std::vector<std::vector<LU<Real>>> _factors;
+
+            /**
+             * @brief Levels' injections, coarse to fine dofs.
+             * 
+             */
+            std::vector<std::vector<Natural>> _injections;
+
+            /**
+             * @brief Coarsest level's factorization, if any.
+             * 
+             */
+            std::vector<LU<Real>> _coarse;
+
+        public:
+
+            // Attributes access.
+
+            /**
+             * @brief Number of levels.
+             * 
+             * @return Natural 
+             */
+            inline Natural levels() const { return this->_blocks.size(); }
+
+            // Constructors.
+
+            Multigrid(const Mesh21 &, const Natural &, Sparse<Real> &);
+            Multigrid(Sparse<Real> &, const std::vector<Natural> &, const std::vector<Natural> &, const Natural &components = 1);
+
+            // Preconditioner.
+
+            Vector<Real> operator ()(const Vector<Real> &) const;
+
+        private:
+
+            // Levels.
+
+            void _build(Sparse<Real> &, std::vector<Natural>, std::vector<Natural>, const Natural &);
+
+            // Cycle.
+
+            void _smooth(const Natural &, const Vector<Real> &, Vector<Real> &, const bool &) const;
+            Vector<Real> _cycle(const Natural &, const Vector<Real> &) const;
+
+    };
+
+}
+
+#endif
@@ -13,10 +13,39 @@
 
 #include "./Stiffness.hpp"
 #include "./Forcing.hpp"
+#include "./Multigrid.hpp"
 
 namespace ivo {
 
-    Vector<Real> solve(const Mesh21 &, const Sparse<Real> &, const Vector<Real> &, const Initial &);
+    /**
+     * @brief Time slab solution strategies.
+     * 
+     */
+    enum class Strategy {
+        Slab, // Preconditioned GMRES on the whole slab.
+        Diagonalized, // Time modes diagonalization, falls back to Slab.
+        AllAtOnce // Preconditioned GMRES on windows of time slabs.
+    };
+
+    /**
+     * @brief Linear solvers' stopping criteria.
+     * 
+     */
+    enum class Stopping {
+        Absolute, // Residual below constants::algebra_zero.
+        Relative, // Residual below constants::solvers_tolerance, relative.
+        Adaptive // Residual below the past time slab's jump estimate, relative for the first slab.
+    };
+
+    namespace internal {
+
+        Vector<Real> initial_jump(const Mesh21 &, const Initial &);
+        std::optional<Vector<Real>> diagonalized(const Mesh21 &, const Natural &, Sparse<Real> &, const Vector<Real> &, const Real &tolerance = 0.0L);
+        Vector<Real> all_at_once(const Mesh21 &, const Sparse<Real> &, const Vector<Real> &, const Initial &, const Real &tolerance = 0.0L);
+
+    }
+
+    Vector<Real> solve(const Mesh21 &, const Sparse<Real> &, const Vector<Real> &, const Initial &, const Strategy &strategy = Strategy::Slab, const Stopping &stopping = Stopping::Absolute);
 
 }
 
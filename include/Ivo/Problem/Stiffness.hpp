@@ -16,6 +16,8 @@
 namespace ivo {
 
     Sparse<Real> stiffness(const Mesh21 &, const Equation &);
+    Sparse<Real> jump(const Mesh21 &);
+    Sparse<Real> coupling(const Mesh21 &);
 
 }
 
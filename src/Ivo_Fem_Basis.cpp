@@ -26,11 +26,8 @@ namespace ivo {
          */
         std::tuple<Vector<Real>, Real> reference_to_element(const Mesh21 &mesh, const Natural &j, const Vector<Real> &nodes) {
 
-            // Element.
-            const Element21 element = mesh.element(j);
-
             // Time.
-            const auto [a, b] = element.interval();
+            const auto [a, b] = mesh.interval(j);
             const Real dt = (b - a) / 2.0L;
 
             // Nodes and dt.
@@ -55,44 +52,25 @@ namespace ivo {
             assert(nodesx.size() == nodesy.size());
             #endif
 
-            // Element.
-            const Element21 element = mesh.element(j);
-
-            // Base.
-            const Polygon21 base = element.b_base();
-
-            // Triangles.
-            const std::vector<Polygon21> triangles = triangulate(base);
-
-            // Triangle.
-            const Polygon21 triangle = triangles[k];
-
-            // Jacobian.
-            Matrix<Real> J{2, 2};
+            // Cell.
+            const Cell21 &cell = mesh.cell(j);
 
-            J(0, 0, triangle(1)(0) - triangle(0)(0));
-            J(0, 1, triangle(2)(0) - triangle(0)(0));
-            J(1, 0, triangle(1)(1) - triangle(0)(1));
-            J(1, 1, triangle(2)(1) - triangle(0)(1));
-
-            // Translation.
-            Vector<Real> T{2};
-
-            T(0, triangle(0)(0));
-            T(1, triangle(0)(1));
+            #ifndef NDEBUG // Integrity check.
+            assert(k < cell.triangles());
+            #endif
 
-            // Jacobian's determinant.
-            const Real dxy = J(0, 0) * J(1, 1) - J(0, 1) * J(1, 0);
+            // Jacobian, translation and determinant.
+            const auto [J_00, J_01, J_10, J_11] = cell.jacobian(k);
+            const auto [T_x, T_y] = cell.translation(k);
+            const Real dxy = cell.determinant(k);
 
             // Space.
             Vector<Real> x{nodesx.size()};
             Vector<Real> y{nodesy.size()};
 
             for(Natural h = 0; h < nodesx.size(); ++h) {
-                Vector<Real> xy = J * Vector<Real>{{nodesx(h), nodesy(h)}} + T;
-
-                x(h, xy(0));
-                y(h, xy(1));
+                x(h, J_00 * nodesx(h) + J_01 * nodesy(h) + T_x);
+                y(h, J_10 * nodesx(h) + J_11 * nodesy(h) + T_y);
             }
 
             // Nodes and dxy.
@@ -110,57 +88,36 @@ namespace ivo {
          */
         std::tuple<std::array<Vector<Real>, 2>, Vector<Real>, Real> reference_to_element(const Mesh21 &mesh, const Natural &j, const Natural &k, const Vector<Real> &nodes) {
 
-            // Element.
-            const Element21 element = mesh.element(j);
-
-            // Base.
-            const Polygon21 base = element.b_base();
-
-            // Edges.
-            const std::vector<Edge21> edges = base.edges();
+            // Cell.
+            const Cell21 &cell = mesh.cell(j);
 
             #ifndef NDEBUG // Integrity check.
-            assert(k < edges.size());
+            assert(k < cell.edges());
             #endif
 
-            // Edge.
-            const Edge21 edge = edges[k];
-
-            // Jacobian.
-            Matrix<Real> J{2, 2};
-
-            J(0, 0, edge(1)(0) - edge(0)(0));
-            J(0, 1, 0.5L * J(0, 0));
-            J(1, 0, edge(1)(1) - edge(0)(1));
-            J(1, 1, 0.5L * J(1, 0));
-
-            // Translation.
-            Vector<Real> T{2};
-
-            T(0, edge(0)(0));
-            T(1, edge(0)(1));
+            // Edge's origin and direction.
+            const auto [O_x, O_y] = cell.origin(k);
+            const auto [D_x, D_y] = cell.direction(k);
 
             // Space.
             Vector<Real> x{nodes.size()};
             Vector<Real> y{nodes.size()};
 
-            for(Natural k = 0; k < nodes.size(); ++k) {
-                Vector<Real> xy = J * Vector<Real>{{nodes(k), 0.0L}} + T;
-
-                x(k, xy(0));
-                y(k, xy(1));
+            for(Natural h = 0; h < nodes.size(); ++h) {
+                x(h, D_x * nodes(h) + O_x);
+                y(h, D_y * nodes(h) + O_y);
             }
 
             // Edge size.
-            const Real de = distance(edge(0), edge(1));
+            const Real de = cell.length(k);
 
             // Edge normal.
-            Vector<Real> normal{2};
+            const auto [n_x, n_y] = cell.normal(k);
 
-            normal(0, edge(1)(1) - edge(0)(1));
-            normal(1, edge(0)(0) - edge(1)(0));
+            Vector<Real> normal{2};
 
-            normal /= norm(normal);
+            normal(0, n_x);
+            normal(1, n_y);
 
             return {{x, y}, normal, de};
         }
@@ -178,10 +135,10 @@ namespace ivo {
     std::array<Matrix<Real>, 2> basis_t(const Mesh21 &mesh, const Natural &j, const Vector<Real> &nodes) {
 
         // Element.
-        const Element21 element = mesh.element(j);
+        const Element21 &element = mesh.element(j);
 
         // Time.
-        const auto [a, b] = element.interval();
+        const auto [a, b] = mesh.interval(j);
         const Real dt = 2.0L / (b - a);
         const Vector<Real> t = dt * (nodes - (a + b) / 2.0L);
 
@@ -196,121 +153,387 @@ namespace ivo {
         Matrix<Real> gradt_phi{rows, columns};
 
         // Polynomial evaluations.
+        const auto [P, dP] = internal::legendres(t, q);
+
         for(Natural k = 0; k < columns; ++k) {
             Real coefficient = std::sqrt(k + 0.5L);
 
-            phi.column(k, coefficient * internal::legendre(t, k, 0));
-            gradt_phi.column(k, dt * coefficient * internal::legendre(t, k, 1));
+            for(Natural h = 0; h < rows; ++h) {
+                phi(h, k, coefficient * P(k, h));
+                gradt_phi(h, k, dt * coefficient * dP(k, h));
+            }
         }
 
         return {phi, gradt_phi};
     }
 
-    /**
-     * @brief Space basis evaluation.
-     * 
-     * @param mesh Mesh.
-     * @param j Element's index.
-     * @param nodes Nodes.
-     * @return std::tuple<Matrix<Real>, Matrix<Real>, Matrix<Real>, Real> 
-     */
-    std::array<Matrix<Real>, 3> basis_xy(const Mesh21 &mesh, const Natural &j, const std::array<Vector<Real>, 2> &nodes) {
+    namespace internal {
+
+        /**
+         * @brief Space basis evaluation, tensor Legendre polynomials over the element's bounding box.
+         * 
+         * @param mesh Mesh.
+         * @param j Element's index.
+         * @param nodes Nodes.
+         * @return std::array<Matrix<Real>, 3> 
+         */
+        std::array<Matrix<Real>, 3> box_basis_xy(const Mesh21 &mesh, const Natural &j, const std::array<Vector<Real>, 2> &nodes) {
         
-        // Nodes.
-        auto [nodesx, nodesy] = nodes;
+            // Nodes.
+            auto [nodesx, nodesy] = nodes;
 
-        #ifndef NDEBUG // Integrity check.
-        assert(nodesx.size() == nodesy.size());
-        #endif
+            #ifndef NDEBUG // Integrity check.
+            assert(nodesx.size() == nodesy.size());
+            #endif
 
-        // Element.
-        const Element21 element = mesh.element(j);
+            // Space degree.
+            const Natural p = mesh.element(j).p();
 
-        // Space degree.
-        const Natural p = element.p();
+            // Evaluations.
+            const Natural rows = nodesx.size();
+            const Natural columns = (p + 1) * (p + 2) / 2;
 
-        // Evaluations.
-        const Natural rows = nodesx.size();
-        const Natural columns = (p + 1) * (p + 2) / 2;
+            Matrix<Real> phi{rows, columns};
+            Matrix<Real> gradx_phi{rows, columns};
+            Matrix<Real> grady_phi{rows, columns};
 
-        Matrix<Real> phi{rows, columns};
-        Matrix<Real> gradx_phi{rows, columns};
-        Matrix<Real> grady_phi{rows, columns};
+            // Box map, inverse.
+            const auto [x_c, y_c, h_x, h_y] = mesh.cell(j).box();
+
+            // Space.
+            Vector<Real> x{nodesx.size()};
+            Vector<Real> y{nodesy.size()};
+
+            for(Natural k = 0; k < nodesx.size(); ++k) {
+                x(k, (nodesx(k) - x_c) / h_x);
+                y(k, (nodesy(k) - y_c) / h_y);
+            }
+
+            // Degrees.
+            std::vector<Natural> px, py;
+
+            for(Natural kx = 0; kx < p + 1; ++kx)
+                for(Natural ky = 0; ky < p + 1 - kx; ++ky) {
+                    px.emplace_back(kx);
+                    py.emplace_back(ky);
+                }
+
+            // Polynomial evaluations, all degrees at once.
+            const auto [Px, dPx] = internal::legendres(x, p);
+            const auto [Py, dPy] = internal::legendres(y, p);
+
+            for(Natural k = 0; k < columns; ++k) {
+                Real coefficient = std::sqrt((2.0L * px[k] + 1.0L) * (2.0L * py[k] + 1.0L)) / 2.0L;
+
+                for(Natural h = 0; h < rows; ++h) {
+                    phi(h, k, coefficient * Px(px[k], h) * Py(py[k], h));
+                    gradx_phi(h, k, coefficient * dPx(px[k], h) * Py(py[k], h));
+                    grady_phi(h, k, coefficient * Px(px[k], h) * dPy(py[k], h));
+                }
+            }
+
+            // Gradients.
+            gradx_phi /= h_x;
+            grady_phi /= h_y;
+
+            return {phi, gradx_phi, grady_phi};
+        }
+
+        /**
+         * @brief Change of basis orthonormalizing an element's space basis.
+         * Modified Gram-Schmidt, twice, against the element's polygon-native quadrature, by increasing total degree
+         * so that lower degrees span the same spaces. Computed once per distinct polygon and degree, cached process-wide on the heap.
+         * 
+         * @param mesh Mesh.
+         * @param j Element's index.
+         * @return Matrix<Real> Upper triangular in graded order, orthonormal basis = box basis * C.
+         */
+        Matrix<Real> orthonormalization(const Mesh21 &mesh, const Natural &j) {
+            static std::map<std::vector<Real>, Matrix<Real>> changes;
+            static std::mutex lock;
+
+            // Space degree.
+            const Natural p = mesh.element(j).p();
+
+            // Key, degree and cell's vertices.
+            std::vector<Real> key{static_cast<Real>(p)};
+            key.insert(key.end(), mesh.cell(j).vertices().begin(), mesh.cell(j).vertices().end());
+
+            {
+                std::lock_guard<std::mutex> guard{lock};
+
+                if(auto change = changes.find(key); change != changes.end())
+                    return change->second;
+            }
+
+            // Orthonormalization, outside of any arena.
+            internal::Scope scope{internal::heap()};
 
-        // Base.
-        const Polygon21 base = element.b_base();
+            const Natural columns = (p + 1) * (p + 2) / 2;
 
-        // Box.
-        auto [xy_min, xy_max] = box2(base);
+            // Box basis, exact mass products.
+            auto [nodes2xy_j, weights2_j] = internal::polygon_quadrature(mesh, j, 2 * p);
+            auto [phi, gradx_phi, grady_phi] = internal::box_basis_xy(mesh, j, nodes2xy_j);
 
-        const Real x_min = xy_min(0), y_min = xy_min(1);
-        const Real x_max = xy_max(0), y_max = xy_max(1);
+            // Graded order, modes are stored by (kx, ky), kx + ky <= p.
+            std::vector<Natural> graded;
 
-        // Box map.
-        Matrix<Real> M{2, 2};
+            for(Natural d = 0; d < p + 1; ++d)
+                for(Natural kx = d + 1; kx-- > 0;)
+                    graded.emplace_back(kx * (p + 1) - kx * (kx - 1) / 2 + (d - kx));
 
-        M(0, 0, 0.5L * (x_max - x_min));
-        M(1, 1, 0.5L * (y_max - y_min));
+            // Orthonormalized evaluations and coefficients.
+            Matrix<Real> Q{phi.rows(), columns};
+            Matrix<Real> C{columns, columns};
 
-        Real M_det = M(0, 0) * M(1, 1);
+            for(Natural k = 0; k < columns; ++k) {
+                const Natural h = graded[k];
 
-        Vector<Real> T{2};
+                for(Natural r = 0; r < phi.rows(); ++r)
+                    Q(r, h, phi(r, h));
 
-        T(0, 0.5L * (x_max + x_min));
-        T(1, 0.5L * (y_max + y_min));
+                C(h, h, 1.0L);
 
-        // Inverse map.
-        Matrix<Real> M_inv{2, 2};
+                for(Natural pass = 0; pass < 2; ++pass)
+                    for(Natural l = 0; l < k; ++l) {
+                        const Natural i = graded[l];
+                        Real projection = 0.0L;
 
-        M_inv(0, 0, M(1, 1) / M_det);
-        M_inv(1, 1, M(0, 0) / M_det);
+                        for(Natural r = 0; r < phi.rows(); ++r)
+                            projection += weights2_j(r) * Q(r, i) * Q(r, h);
 
-        Vector<Real> T_inv = -(M_inv * T);
+                        for(Natural r = 0; r < phi.rows(); ++r)
+                            Q(r, h, Q(r, h) - projection * Q(r, i));
 
-        // Space.
-        Vector<Real> x{nodesx.size()};
-        Vector<Real> y{nodesy.size()};
+                        for(Natural s = 0; s < columns; ++s)
+                            C(s, h, C(s, h) - projection * C(s, i));
+                    }
 
-        for(Natural k = 0; k < nodesx.size(); ++k) {
-            Vector<Real> xy = M_inv * Vector<Real>{{nodesx(k), nodesy(k)}} + T_inv;
+                Real squared = 0.0L;
 
-            x(k, xy(0));
-            y(k, xy(1));
+                for(Natural r = 0; r < phi.rows(); ++r)
+                    squared += weights2_j(r) * Q(r, h) * Q(r, h);
+
+                #ifndef NDEBUG // Integrity check.
+                assert(squared > constants::zero);
+                #endif
+
+                const Real scale = 1.0L / std::sqrt(squared);
+
+                for(Natural r = 0; r < phi.rows(); ++r)
+                    Q(r, h, Q(r, h) * scale);
+
+                for(Natural s = 0; s < columns; ++s)
+                    C(s, h, C(s, h) * scale);
+            }
+
+            std::lock_guard<std::mutex> guard{lock};
+            return changes.try_emplace(key, std::move(C)).first->second;
         }
 
-        // Degrees.
-        std::vector<Natural> px, py;
+        // Tabulations.
+
+        /**
+         * @brief Cached space basis tabulations, shared across time slabs and routines.
+         * Least recently used entries are evicted past constants::tabulation_cap bytes.
+         * 
+         * @param key Tabulation's key.
+         * @param evaluation Tabulation, evaluated on a miss.
+         * @return std::array<Matrix<Real>, 3> 
+         */
+        std::array<Matrix<Real>, 3> tabulation(const std::vector<Real> &key, const std::function<std::array<Matrix<Real>, 3> ()> &evaluation) {
+            static std::map<std::vector<Real>, std::tuple<std::array<Matrix<Real>, 3>, std::list<std::vector<Real>>::iterator>> tabulations;
+            static std::list<std::vector<Real>> recent;
+            static Natural bytes = 0;
+            static std::mutex lock;
+
+            {
+                std::lock_guard<std::mutex> guard{lock};
+
+                if(auto entry = tabulations.find(key); entry != tabulations.end()) {
+                    auto &[basis, position] = entry->second;
+                    recent.splice(recent.begin(), recent, position);
+                    return basis;
+                }
+            }
+
+            // Evaluation, outside of any arena.
+            internal::Scope scope{internal::heap()};
+            auto basis = evaluation();
+
+            const Natural size = 3 * basis[0].rows() * basis[0].columns() * sizeof(Real);
+
+            std::lock_guard<std::mutex> guard{lock};
 
-        for(Natural kx = 0; kx < p + 1; ++kx)
-            for(Natural ky = 0; ky < p + 1 - kx; ++ky) {
-                px.emplace_back(kx);
-                py.emplace_back(ky);
+            if(auto entry = tabulations.find(key); entry != tabulations.end())
+                return std::get<0>(entry->second);
+
+            // Eviction.
+            while(!recent.empty() && (bytes + size > constants::tabulation_cap)) {
+                auto evicted = tabulations.find(recent.back());
+                bytes -= 3 * std::get<0>(evicted->second)[0].rows() * std::get<0>(evicted->second)[0].columns() * sizeof(Real);
+
+                tabulations.erase(evicted);
+                recent.pop_back();
             }
 
-        // Polynomial evaluations.
-        for(Natural k = 0; k < columns; ++k) {
-            Vector<Real> legendre_x = internal::legendre(x, px[k], 0);
-            Vector<Real> legendre_y = internal::legendre(y, py[k], 0);
+            recent.emplace_front(key);
+            bytes += size;
+
+            return std::get<0>(tabulations.try_emplace(key, std::move(basis), recent.begin()).first->second);
+        }
+
+        /**
+         * @brief Space basis at an element's polygon-native volume nodes.
+         * 
+         * @param mesh Mesh.
+         * @param j Element's index.
+         * @param degree Rule's exactness degree.
+         * @return std::array<Matrix<Real>, 3> 
+         */
+        std::array<Matrix<Real>, 3> tabulated_xy(const Mesh21 &mesh, const Natural &j, const Natural &degree) {
+            const std::vector<Real> &vertices = mesh.cell(j).vertices();
+
+            // Key, volume, degrees and cell's vertices.
+            std::vector<Real> key{0.0L, static_cast<Real>(mesh.element(j).p()), static_cast<Real>(degree)};
+            key.insert(key.end(), vertices.begin(), vertices.end());
+
+            return internal::tabulation(key, [&mesh, &j, &degree]() -> std::array<Matrix<Real>, 3> {
+                auto [nodes2xy_j, weights2_j] = internal::polygon_quadrature(mesh, j, degree);
+                return basis_xy(mesh, j, nodes2xy_j);
+            });
+        }
+
+        /**
+         * @brief Space basis of an element at another element's edge nodes.
+         * 
+         * @param mesh Mesh.
+         * @param i Evaluated element's index.
+         * @param j Edge's element's index.
+         * @param k Edge's index.
+         * @param n Gauss rule's order.
+         * @return std::array<Matrix<Real>, 3> 
+         */
+        std::array<Matrix<Real>, 3> tabulated_xy(const Mesh21 &mesh, const Natural &i, const Natural &j, const Natural &k, const Natural &n) {
+            const std::vector<Real> &vertices_i = mesh.cell(i).vertices();
+            const std::vector<Real> &vertices_j = mesh.cell(j).vertices();
+
+            // Key, face, degree, rule, edge and cells' vertices.
+            std::vector<Real> key{1.0L, static_cast<Real>(mesh.element(i).p()), static_cast<Real>(n), static_cast<Real>(k), static_cast<Real>(vertices_j.size())};
+            key.insert(key.end(), vertices_j.begin(), vertices_j.end());
+            key.insert(key.end(), vertices_i.begin(), vertices_i.end());
+
+            return internal::tabulation(key, [&mesh, &i, &j, &k, &n]() -> std::array<Matrix<Real>, 3> {
+                const auto &[nodes1x, weights1x] = quadrature1x(n);
+                auto [e_nodes2xy_j, normal, e_dxy_j] = internal::reference_to_element(mesh, j, k, nodes1x);
+                return basis_xy(mesh, i, e_nodes2xy_j);
+            });
+        }
 
-            Real coefficient = std::sqrt((2.0L * px[k] + 1.0L) * (2.0L * py[k] + 1.0L)) / 2.0L;
+        // Reference time matrices.
 
-            Vector<Real> grad_legendre_x = internal::legendre(x, px[k], 1);
-            Vector<Real> grad_legendre_y = internal::legendre(y, py[k], 1);
+        /**
+         * @brief Reference time mass, derivative and jump matrices of a given degree, over [-1, 1].
+         * Element matrices follow by scaling, mass by dt, derivative and jump unchanged. Cached process-wide on the heap.
+         * 
+         * @param q Time degree.
+         * @return const std::array<Matrix<Real>, 3>& (*, *), (*, *') and (*(-1), *(-1)). 
+         */
+        const std::array<Matrix<Real>, 3> &time_matrices(const Natural &q) {
+            static std::map<Natural, std::array<Matrix<Real>, 3>> matrices;
+            static std::mutex lock;
+
+            {
+                std::lock_guard<std::mutex> guard{lock};
+
+                if(auto entry = matrices.find(q); entry != matrices.end())
+                    return entry->second;
+            }
+
+            // Evaluation, outside of any arena.
+            internal::Scope scope{internal::heap()};
+
+            const auto &[nodes1t, weights1t] = quadrature1t(internal::order(2 * q));
+            const auto [P, dP] = internal::legendres(nodes1t, q);
+            const Vector<Real> &f_phi_t = internal::time_traces(q)[0];
+
+            Matrix<Real> M{q + 1, q + 1};
+            Matrix<Real> D{q + 1, q + 1};
+            Matrix<Real> J{q + 1, q + 1};
 
-            phi.column(k, coefficient * legendre_x * legendre_y);
-            gradx_phi.column(k, coefficient * grad_legendre_x * legendre_y);
-            grady_phi.column(k, coefficient * legendre_x * grad_legendre_y);
+            for(Natural jt = 0; jt < q + 1; ++jt)
+                for(Natural ht = 0; ht < q + 1; ++ht) {
+                    const Real coefficient = std::sqrt((jt + 0.5L) * (ht + 0.5L));
+                    Real M_jh = 0.0L, D_jh = 0.0L;
+
+                    for(Natural kt = 0; kt < weights1t.size(); ++kt) {
+                        M_jh += weights1t(kt) * P(jt, kt) * P(ht, kt);
+                        D_jh += weights1t(kt) * P(jt, kt) * dP(ht, kt);
+                    }
+
+                    M(jt, ht, coefficient * M_jh);
+                    D(jt, ht, coefficient * D_jh);
+                    J(jt, ht, f_phi_t(jt) * f_phi_t(ht));
+                }
+
+            std::lock_guard<std::mutex> guard{lock};
+            return matrices.try_emplace(q, std::array<Matrix<Real>, 3>{M, D, J}).first->second;
         }
 
-        // Gradients.
-        for(Natural k = 0; k < rows; ++k)
-            for(Natural h = 0; h < columns; ++h) {
-                Vector<Real> gradient = M_inv * Vector<Real>{{gradx_phi(k, h), grady_phi(k, h)}};
+        /**
+         * @brief Reference time basis' traces at -1 and 1.
+         * 
+         * @param q Time degree.
+         * @return const std::array<Vector<Real>, 2>& 
+         */
+        const std::array<Vector<Real>, 2> &time_traces(const Natural &q) {
+            static std::map<Natural, std::array<Vector<Real>, 2>> traces;
+            static std::mutex lock;
+
+            {
+                std::lock_guard<std::mutex> guard{lock};
+
+                if(auto entry = traces.find(q); entry != traces.end())
+                    return entry->second;
+            }
+
+            // Evaluation, outside of any arena.
+            internal::Scope scope{internal::heap()};
+
+            Vector<Real> a{q + 1};
+            Vector<Real> b{q + 1};
+
+            for(Natural k = 0; k < q + 1; ++k) {
+                const Real coefficient = std::sqrt(k + 0.5L);
 
-                gradx_phi(k, h, gradient(0));
-                grady_phi(k, h, gradient(1));
+                // P_k(-1) = (-1)^k, P_k(1) = 1.
+                a(k, (k % 2 == 0) ? coefficient : -coefficient);
+                b(k, coefficient);
             }
 
+            std::lock_guard<std::mutex> guard{lock};
+            return traces.try_emplace(q, std::array<Vector<Real>, 2>{a, b}).first->second;
+        }
+
+    }
+
+    /**
+     * @brief Space basis evaluation.
+     * Tensor Legendre polynomials over the element's bounding box, orthonormalized per element if constants::orthonormal.
+     * 
+     * @param mesh Mesh.
+     * @param j Element's index.
+     * @param nodes Nodes.
+     * @return std::array<Matrix<Real>, 3> 
+     */
+    std::array<Matrix<Real>, 3> basis_xy(const Mesh21 &mesh, const Natural &j, const std::array<Vector<Real>, 2> &nodes) {
+        auto [phi, gradx_phi, grady_phi] = internal::box_basis_xy(mesh, j, nodes);
+
+        if constexpr (constants::orthonormal) {
+            const Matrix<Real> C = internal::orthonormalization(mesh, j);
+            return {phi * C, gradx_phi * C, grady_phi * C};
+        }
+
         return {phi, gradx_phi, grady_phi};
     }
 
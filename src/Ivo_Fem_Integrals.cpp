@@ -0,0 +1,418 @@
+/**
+ * @file Fem_Integrals.cpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Fem/Integrals.hpp implementation.
+ * @date 2024-11-03
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <Ivo.hpp>
+
+namespace ivo {
+
+    namespace internal {
+
+        // Compile-time kernels, fixed degrees up to constants::kernel_degree.
+
+        /**
+         * @brief Space degree with a given number of dofs, constants::kernel_degree + 1 if none.
+         * 
+         * @param dofs Space dofs.
+         * @return Natural 
+         */
+        constexpr Natural kernel_p(const Natural &dofs) {
+            for(Natural p = 0; p < constants::kernel_degree + 1; ++p)
+                if((p + 1) * (p + 2) / 2 == dofs)
+                    return p;
+
+            return constants::kernel_degree + 1;
+        }
+
+        /**
+         * @brief Weighted product L^T diag(d) R, N functions per side.
+         * 
+         * @tparam N Functions.
+         * @param L Left evaluations.
+         * @param d Weights.
+         * @param R Right evaluations.
+         * @return Matrix<Real> 
+         */
+        template<Natural N>
+        Matrix<Real> weighted_kernel(const Matrix<Real> &L, const Vector<Real> &d, const Matrix<Real> &R) {
+            std::array<Real, N * N> s{};
+
+            const Real *__restrict l = L.data().data();
+            const Real *__restrict r = R.data().data();
+
+            for(Natural k = 0; k < d.size(); ++k) {
+                const Real *l_k = l + k * N;
+                const Real *r_k = r + k * N;
+
+                for(Natural j = 0; j < N; ++j) {
+                    const Real dl_kj = d(k) * l_k[j];
+
+                    for(Natural h = 0; h < N; ++h)
+                        s[j * N + h] += dl_kj * r_k[h];
+                }
+            }
+
+            Matrix<Real> S{N, N};
+            std::copy(s.begin(), s.end(), S.data().begin());
+
+            return S;
+        }
+
+        /**
+         * @brief Kronecker product of a (Q + 1) x (Q + 1) time block and a space block of degree P.
+         * 
+         * @tparam P Space degree.
+         * @tparam Q Time degree.
+         * @param T Time block.
+         * @param S Space block.
+         * @return Matrix<Real> 
+         */
+        template<Natural P, Natural Q>
+        Matrix<Real> kronecker_kernel(const Matrix<Real> &T, const Matrix<Real> &S) {
+            constexpr Natural N_t = Q + 1, N_xy = (P + 1) * (P + 2) / 2, N = N_t * N_xy;
+
+            std::array<Real, N_t * N_t> t;
+            std::array<Real, N_xy * N_xy> s;
+
+            std::copy(T.data().begin(), T.data().end(), t.begin());
+            std::copy(S.data().begin(), S.data().end(), s.begin());
+
+            Matrix<Real> M{N, N};
+            Real *__restrict m = M.data().data();
+
+            for(Natural jt = 0; jt < N_t; ++jt)
+                for(Natural ht = 0; ht < N_t; ++ht) {
+                    const Real t_jh = t[jt * N_t + ht];
+
+                    for(Natural jxy = 0; jxy < N_xy; ++jxy)
+                        for(Natural hxy = 0; hxy < N_xy; ++hxy)
+                            m[(jt * N_xy + jxy) * N + ht * N_xy + hxy] = t_jh * s[jxy * N_xy + hxy];
+                }
+
+            return M;
+        }
+
+        /**
+         * @brief Space-time evaluation of (Q + 1) by P's space dofs coefficients, space contracted first.
+         * 
+         * @tparam P Space degree.
+         * @tparam Q Time degree.
+         * @param Lt Time evaluations.
+         * @param Lxy Space evaluations.
+         * @param coefficients Coefficients.
+         * @return Matrix<Real> 
+         */
+        template<Natural P, Natural Q>
+        Matrix<Real> evaluated_kernel(const Matrix<Real> &Lt, const Matrix<Real> &Lxy, const Vector<Real> &coefficients) {
+            constexpr Natural N_t = Q + 1, N_xy = (P + 1) * (P + 2) / 2;
+
+            std::array<Real, N_t * N_xy> u;
+            std::copy(coefficients.data().begin(), coefficients.data().end(), u.begin());
+
+            Matrix<Real> E{Lt.rows(), Lxy.rows()};
+
+            const Real *__restrict lt = Lt.data().data();
+            const Real *__restrict lxy = Lxy.data().data();
+            Real *__restrict e = E.data().data();
+
+            for(Natural kxy = 0; kxy < Lxy.rows(); ++kxy) {
+                const Real *lxy_k = lxy + kxy * N_xy;
+                std::array<Real, N_t> w{};
+
+                // Space contraction.
+                for(Natural jt = 0; jt < N_t; ++jt)
+                    for(Natural jxy = 0; jxy < N_xy; ++jxy)
+                        w[jt] += u[jt * N_xy + jxy] * lxy_k[jxy];
+
+                // Time contraction.
+                for(Natural kt = 0; kt < Lt.rows(); ++kt) {
+                    Real e_k = 0.0L;
+
+                    for(Natural jt = 0; jt < N_t; ++jt)
+                        e_k += lt[kt * N_t + jt] * w[jt];
+
+                    e[kt * Lxy.rows() + kxy] = e_k;
+                }
+            }
+
+            return E;
+        }
+
+        // Kernels' tables, dispatched once per call.
+
+        using WeightedKernel = Matrix<Real> (*)(const Matrix<Real> &, const Vector<Real> &, const Matrix<Real> &);
+        using KroneckerKernel = Matrix<Real> (*)(const Matrix<Real> &, const Matrix<Real> &);
+        using EvaluatedKernel = Matrix<Real> (*)(const Matrix<Real> &, const Matrix<Real> &, const Vector<Real> &);
+
+        template<Natural... N>
+        constexpr std::array<WeightedKernel, sizeof...(N)> weighted_kernels(std::index_sequence<N...>) {
+            return {&weighted_kernel<N + 1>...};
+        }
+
+        template<Natural... K>
+        constexpr std::array<KroneckerKernel, sizeof...(K)> kronecker_kernels(std::index_sequence<K...>) {
+            return {&kronecker_kernel<K / (constants::kernel_degree + 1), K % (constants::kernel_degree + 1)>...};
+        }
+
+        template<Natural... K>
+        constexpr std::array<EvaluatedKernel, sizeof...(K)> evaluated_kernels(std::index_sequence<K...>) {
+            return {&evaluated_kernel<K / (constants::kernel_degree + 1), K % (constants::kernel_degree + 1)>...};
+        }
+
+        /**
+         * @brief Weighted product L^T diag(d) R, one quadrature dimension contracted.
+         * 
+         * @param L Left evaluations, nodes by functions.
+         * @param d Weights.
+         * @param R Right evaluations, nodes by functions.
+         * @return Matrix<Real> 
+         */
+        Matrix<Real> weighted(const Matrix<Real> &L, const Vector<Real> &d, const Matrix<Real> &R) {
+            #ifndef NDEBUG // Integrity check.
+            assert(L.rows() == d.size());
+            assert(R.rows() == d.size());
+            #endif
+
+            static constexpr auto kernels = internal::weighted_kernels(std::make_index_sequence<(constants::kernel_degree + 1) * (constants::kernel_degree + 2) / 2>{});
+
+            const Natural rows = L.columns(), columns = R.columns();
+
+            // Compile-time kernel, up to the space dofs of degree constants::kernel_degree per side.
+            if((rows == columns) && (rows <= kernels.size()))
+                return kernels[rows - 1](L, d, R);
+
+            Matrix<Real> S{rows, columns};
+
+            const Real *__restrict l = L.data().data();
+            const Real *__restrict r = R.data().data();
+            Real *__restrict s = S.data().data();
+
+            for(Natural k = 0; k < d.size(); ++k) {
+                const Real *l_k = l + k * rows;
+                const Real *r_k = r + k * columns;
+
+                for(Natural j = 0; j < rows; ++j) {
+                    const Real dl_kj = d(k) * l_k[j];
+                    Real *s_j = s + j * columns;
+
+                    for(Natural h = 0; h < columns; ++h)
+                        s_j[h] += dl_kj * r_k[h];
+                }
+            }
+
+            return S;
+        }
+
+        /**
+         * @brief Explicit Kronecker product of a time and a space block.
+         * Entry (jt * S.rows() + jxy, ht * S.columns() + hxy) reads T(jt, ht) S(jxy, hxy).
+         * 
+         * @param T Time block.
+         * @param S Space block.
+         * @return Matrix<Real> 
+         */
+        Matrix<Real> kronecker(const Matrix<Real> &T, const Matrix<Real> &S) {
+            static constexpr auto kernels = internal::kronecker_kernels(std::make_index_sequence<(constants::kernel_degree + 1) * (constants::kernel_degree + 1)>{});
+
+            // Compile-time kernel, square blocks of fixed degrees.
+            if((T.rows() == T.columns()) && (S.rows() == S.columns())) {
+                const Natural p = internal::kernel_p(S.rows()), q = T.rows() - 1;
+
+                if((p <= constants::kernel_degree) && (q <= constants::kernel_degree))
+                    return kernels[p * (constants::kernel_degree + 1) + q](T, S);
+            }
+
+            Matrix<Real> M{T.rows() * S.rows(), T.columns() * S.columns()};
+
+            for(Natural jt = 0; jt < T.rows(); ++jt)
+                for(Natural ht = 0; ht < T.columns(); ++ht)
+                    for(Natural jxy = 0; jxy < S.rows(); ++jxy)
+                        for(Natural hxy = 0; hxy < S.columns(); ++hxy)
+                            M(jt * S.rows() + jxy, ht * S.columns() + hxy, T(jt, ht) * S(jxy, hxy));
+
+            return M;
+        }
+
+        /**
+         * @brief Space-time integrals of products, constant coefficient.
+         * Separable integrand, time and space integrals combined by a Kronecker product.
+         * Entry (jt * Lxy.columns() + jxy, ht * Rxy.columns() + hxy) integrates Lt(jt) Rt(ht) Lxy(jxy) Rxy(hxy).
+         * 
+         * @param Lt Left time evaluations.
+         * @param Rt Right time evaluations.
+         * @param weights_t Time weights.
+         * @param Lxy Left space evaluations.
+         * @param Rxy Right space evaluations.
+         * @param weights_xy Space weights.
+         * @return Matrix<Real> 
+         */
+        Matrix<Real> factorized(const Matrix<Real> &Lt, const Matrix<Real> &Rt, const Vector<Real> &weights_t, const Matrix<Real> &Lxy, const Matrix<Real> &Rxy, const Vector<Real> &weights_xy) {
+
+            // Time and space reference integrals.
+            const Matrix<Real> T = internal::weighted(Lt, weights_t, Rt);
+            const Matrix<Real> S = internal::weighted(Lxy, weights_xy, Rxy);
+
+            return internal::kronecker(T, S);
+        }
+
+        /**
+         * @brief Space-time integrals of products, coefficient given at the quadrature nodes.
+         * Rank-one coefficients, constants included, factor as time times space. Otherwise the integral
+         * is contracted over space nodes first, then over time nodes.
+         * 
+         * @param Lt Left time evaluations.
+         * @param Rt Right time evaluations.
+         * @param weights_t Time weights.
+         * @param Lxy Left space evaluations.
+         * @param Rxy Right space evaluations.
+         * @param weights_xy Space weights.
+         * @param coefficients Coefficient, time nodes by space nodes.
+         * @return Matrix<Real> 
+         */
+        Matrix<Real> factorized(const Matrix<Real> &Lt, const Matrix<Real> &Rt, const Vector<Real> &weights_t, const Matrix<Real> &Lxy, const Matrix<Real> &Rxy, const Vector<Real> &weights_xy, const Matrix<Real> &coefficients) {
+            #ifndef NDEBUG // Integrity check.
+            assert(coefficients.rows() == weights_t.size());
+            assert(coefficients.columns() == weights_xy.size());
+            #endif
+
+            const Natural nodes_t = weights_t.size(), nodes_xy = weights_xy.size();
+
+            // Pivot.
+            Natural k0 = 0, l0 = 0;
+
+            for(Natural kt = 0; kt < nodes_t; ++kt)
+                for(Natural kxy = 0; kxy < nodes_xy; ++kxy)
+                    if(std::abs(coefficients(kt, kxy)) > std::abs(coefficients(k0, l0))) {
+                        k0 = kt;
+                        l0 = kxy;
+                    }
+
+            const Real pivot = coefficients(k0, l0);
+
+            // Vanishing coefficient.
+            if(std::abs(pivot) <= constants::zero)
+                return Matrix<Real>{Lt.columns() * Lxy.columns(), Rt.columns() * Rxy.columns()};
+
+            // Rank-one check, c(t, x, y) = a(t) b(x, y).
+            Vector<Real> a{nodes_t};
+            Vector<Real> b{nodes_xy};
+
+            for(Natural kt = 0; kt < nodes_t; ++kt)
+                a(kt, coefficients(kt, l0) / pivot);
+
+            for(Natural kxy = 0; kxy < nodes_xy; ++kxy)
+                b(kxy, coefficients(k0, kxy));
+
+            bool separable = true;
+
+            for(Natural kt = 0; (kt < nodes_t) && separable; ++kt)
+                for(Natural kxy = 0; kxy < nodes_xy; ++kxy)
+                    if(std::abs(coefficients(kt, kxy) - a(kt) * b(kxy)) > constants::kronecker_zero * std::abs(pivot)) {
+                        separable = false;
+                        break;
+                    }
+
+            if(separable) {
+                Vector<Real> a_weights_t{nodes_t};
+                Vector<Real> b_weights_xy{nodes_xy};
+
+                for(Natural kt = 0; kt < nodes_t; ++kt)
+                    a_weights_t(kt, a(kt) * weights_t(kt));
+
+                for(Natural kxy = 0; kxy < nodes_xy; ++kxy)
+                    b_weights_xy(kxy, b(kxy) * weights_xy(kxy));
+
+                return internal::factorized(Lt, Rt, a_weights_t, Lxy, Rxy, b_weights_xy);
+            }
+
+            // General case, one dimension at a time.
+            const Natural rows_xy = Lxy.columns(), columns_xy = Rxy.columns();
+
+            Matrix<Real> M{Lt.columns() * rows_xy, Rt.columns() * columns_xy};
+            Vector<Real> c_weights_xy{nodes_xy};
+
+            for(Natural kt = 0; kt < nodes_t; ++kt) {
+
+                // Space contraction at the time node.
+                for(Natural kxy = 0; kxy < nodes_xy; ++kxy)
+                    c_weights_xy(kxy, coefficients(kt, kxy) * weights_xy(kxy));
+
+                const Matrix<Real> S = internal::weighted(Lxy, c_weights_xy, Rxy);
+
+                // Time contraction.
+                for(Natural jt = 0; jt < Lt.columns(); ++jt)
+                    for(Natural ht = 0; ht < Rt.columns(); ++ht) {
+                        const Real T_jh = weights_t(kt) * Lt(kt, jt) * Rt(kt, ht);
+
+                        for(Natural jxy = 0; jxy < rows_xy; ++jxy)
+                            for(Natural hxy = 0; hxy < columns_xy; ++hxy)
+                                M(jt * rows_xy + jxy, ht * columns_xy + hxy, M(jt * rows_xy + jxy, ht * columns_xy + hxy) + T_jh * S(jxy, hxy));
+                    }
+            }
+
+            return M;
+        }
+
+        // Space-time evaluations.
+
+        /**
+         * @brief Space-time evaluation of an element's coefficients, sum of Lt(kt, jt) Lxy(kxy, jxy) c(jt * Lxy.columns() + jxy).
+         * Space contracted first, compile-time kernels for fixed degrees.
+         * 
+         * @param Lt Time evaluations.
+         * @param Lxy Space evaluations.
+         * @param coefficients Coefficients.
+         * @return Matrix<Real> Time nodes by space nodes.
+         */
+        Matrix<Real> evaluated(const Matrix<Real> &Lt, const Matrix<Real> &Lxy, const Vector<Real> &coefficients) {
+            #ifndef NDEBUG // Integrity check.
+            assert(coefficients.size() == Lt.columns() * Lxy.columns());
+            #endif
+
+            static constexpr auto kernels = internal::evaluated_kernels(std::make_index_sequence<(constants::kernel_degree + 1) * (constants::kernel_degree + 1)>{});
+
+            const Natural dofs_t = Lt.columns(), dofs_xy = Lxy.columns();
+            const Natural p = internal::kernel_p(dofs_xy), q = dofs_t - 1;
+
+            // Compile-time kernel.
+            if((p <= constants::kernel_degree) && (q <= constants::kernel_degree))
+                return kernels[p * (constants::kernel_degree + 1) + q](Lt, Lxy, coefficients);
+
+            Matrix<Real> E{Lt.rows(), Lxy.rows()};
+            Vector<Real> w{dofs_t};
+
+            for(Natural kxy = 0; kxy < Lxy.rows(); ++kxy) {
+
+                // Space contraction.
+                for(Natural jt = 0; jt < dofs_t; ++jt) {
+                    Real w_j = 0.0L;
+
+                    for(Natural jxy = 0; jxy < dofs_xy; ++jxy)
+                        w_j += coefficients(jt * dofs_xy + jxy) * Lxy(kxy, jxy);
+
+                    w(jt, w_j);
+                }
+
+                // Time contraction.
+                for(Natural kt = 0; kt < Lt.rows(); ++kt) {
+                    Real e_k = 0.0L;
+
+                    for(Natural jt = 0; jt < dofs_t; ++jt)
+                        e_k += Lt(kt, jt) * w(jt);
+
+                    E(kt, kxy, e_k);
+                }
+            }
+
+            return E;
+        }
+
+    }
+
+}
@@ -21,16 +21,18 @@ namespace ivo {
          * @param k Natural.
          * @return Natural 
          */
-        Natural binomial(const Natural &n, const Natural &k) {
+        constexpr Natural binomial(const Natural &n, const Natural &k) {
             #ifndef NDEBUG // Integrity check.
             assert(n >= k);
             #endif
 
-            if((n == k) || (k == 0))
-                return 1;
+            // Multiplicative formula, exact at every step.
+            Natural coefficient = 1;
 
-            // Recursive formula.
-            return internal::binomial(n - 1, k - 1) + internal::binomial(n - 1, k);
+            for(Natural j = 1; j <= std::min(k, n - k); ++j)
+                coefficient = coefficient * (n + 1 - j) / j;
+
+            return coefficient;
         }
 
         /**
@@ -42,24 +44,112 @@ namespace ivo {
          * @return Vector<Real> 
          */
         Vector<Real> legendre(const Vector<Real> &x, const Natural &n, const Natural &k) {
+
+            // Values and first derivatives, recurrence.
+            if(k <= 1)
+                return internal::legendres(x, n)[k].row(n);
+
             Vector<Real> y{x.size()};
 
-            // Recursive formula.
-            for(Natural j = k; j <= n; ++j) {
-                Vector<Real> y_j{x.size(), 1.0L};
+            if(k > n)
+                return y;
 
-                for(Natural h = 0; h < j - k; ++h)
-                    y_j *= 0.5L * (x - 1.0L);
+            // Explicit formula, higher derivatives.
+            const Vector<Real> half = 0.5L * (x - 1.0L);
+            Vector<Real> power{x.size(), 1.0L};
+
+            for(Natural j = k; j <= n; ++j) {
+                Real falling = 1.0L;
 
                 for(Natural h = 0; h < k; ++h)
-                    y_j *= 0.5L * static_cast<Real>(j - h);
+                    falling *= 0.5L * static_cast<Real>(j - h);
 
-                y += internal::binomial(n, j) * internal::binomial(n + j, j) * y_j;
+                y += (static_cast<Real>(internal::binomial(n, j)) * static_cast<Real>(internal::binomial(n + j, j)) * falling) * power;
+                power *= half;
             }
 
             return y;
         }
 
+        /**
+         * @brief Legendre polynomials of degree 0 to n and their derivatives over a vector of points.
+         * Bonnet's recurrence, one contiguous row per degree.
+         * 
+         * @param x Real points.
+         * @param n Maximum degree.
+         * @return std::array<Matrix<Real>, 2> P_0..P_n, P'_0..P'_n.
+         */
+        std::array<Matrix<Real>, 2> legendres(const Vector<Real> &x, const Natural &n) {
+            const Natural points = x.size();
+
+            Matrix<Real> P{n + 1, points};
+            Matrix<Real> dP{n + 1, points};
+
+            const Real *x_entries = x.data().data();
+            Real *P_entries = P.data().data();
+            Real *dP_entries = dP.data().data();
+
+            // Degree 0.
+            std::fill(P_entries, P_entries + points, 1.0L);
+
+            if(n == 0)
+                return {P, dP};
+
+            // Degree 1.
+            std::copy(x_entries, x_entries + points, P_entries + points);
+            std::fill(dP_entries + points, dP_entries + 2 * points, 1.0L);
+
+            // Recurrence.
+            for(Natural m = 1; m < n; ++m) {
+                const Real a = static_cast<Real>(2 * m + 1) / static_cast<Real>(m + 1);
+                const Real b = static_cast<Real>(m) / static_cast<Real>(m + 1);
+                const Real c = static_cast<Real>(2 * m + 1);
+
+                const Real *P_previous = P_entries + (m - 1) * points;
+                const Real *P_current = P_entries + m * points;
+                const Real *dP_previous = dP_entries + (m - 1) * points;
+                Real *P_next = P_entries + (m + 1) * points;
+                Real *dP_next = dP_entries + (m + 1) * points;
+
+                for(Natural j = 0; j < points; ++j) {
+                    P_next[j] = a * x_entries[j] * P_current[j] - b * P_previous[j];
+                    dP_next[j] = dP_previous[j] + c * P_current[j];
+                }
+            }
+
+            return {P, dP};
+        }
+
+        /**
+         * @brief Legendre polynomials' monomial coefficients, degree 0 to n.
+         * Bonnet's recurrence on the coefficients.
+         * 
+         * @param n Maximum degree.
+         * @return Matrix<Real> Row k holds P_k's coefficients by increasing power.
+         */
+        Matrix<Real> legendre_monomials(const Natural &n) {
+            Matrix<Real> C{n + 1, n + 1};
+
+            // Degrees 0 and 1.
+            C(0, 0, 1.0L);
+
+            if(n == 0)
+                return C;
+
+            C(1, 1, 1.0L);
+
+            // Recurrence.
+            for(Natural m = 1; m < n; ++m) {
+                const Real a = static_cast<Real>(2 * m + 1) / static_cast<Real>(m + 1);
+                const Real b = static_cast<Real>(m) / static_cast<Real>(m + 1);
+
+                for(Natural k = 0; k < m + 2; ++k)
+                    C(m + 1, k, ((k > 0) ? a * C(m, k - 1) : 0.0L) - b * C(m - 1, k));
+            }
+
+            return C;
+        }
+
     }
 
-}
\ No newline at end of file
+}
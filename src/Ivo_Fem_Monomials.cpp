@@ -0,0 +1,265 @@
+/**
+ * @file Fem_Monomials.cpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Fem/Monomials.hpp implementation.
+ * @date 2024-11-05
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <Ivo.hpp>
+
+namespace ivo {
+
+    namespace internal {
+
+        /**
+         * @brief Powers 0 to n of an affine polynomial a + bs, by increasing power of s.
+         * 
+         * @param a Constant term.
+         * @param b Linear term.
+         * @param n Highest power.
+         * @return std::vector<std::vector<Real>> 
+         */
+        std::vector<std::vector<Real>> powers(const Real &a, const Real &b, const Natural &n) {
+            std::vector<std::vector<Real>> powers{{1.0L}};
+
+            for(Natural k = 0; k < n; ++k) {
+                std::vector<Real> next(k + 2, 0.0L);
+
+                for(Natural m = 0; m < k + 1; ++m) {
+                    next[m] += a * powers[k][m];
+                    next[m + 1] += b * powers[k][m];
+                }
+
+                powers.emplace_back(next);
+            }
+
+            return powers;
+        }
+
+        // Space basis' monomial coefficients.
+
+        /**
+         * @brief Space basis' coefficients over the monomials of the element's bounding box coordinates.
+         * Monomial xi^a eta^b, xi = (x - x_c) / h_x and eta = (y - y_c) / h_y, is column a * (p + 1) + b.
+         * 
+         * @param mesh Mesh.
+         * @param j Element's index.
+         * @return std::array<Matrix<Real>, 3> Basis, x and y derivatives, one row per function.
+         */
+        std::array<Matrix<Real>, 3> monomials_xy(const Mesh21 &mesh, const Natural &j) {
+
+            // Space degree.
+            const Natural p = mesh.element(j).p();
+
+            const Natural rows = (p + 1) * (p + 2) / 2;
+            const Natural columns = (p + 1) * (p + 1);
+
+            Matrix<Real> phi{rows, columns};
+            Matrix<Real> gradx_phi{rows, columns};
+            Matrix<Real> grady_phi{rows, columns};
+
+            // Box's half sizes.
+            const auto [x_c, y_c, h_x, h_y] = mesh.cell(j).box();
+
+            // Legendre coefficients.
+            const Matrix<Real> C = internal::legendre_monomials(p);
+
+            Natural k = 0;
+
+            for(Natural kx = 0; kx < p + 1; ++kx)
+                for(Natural ky = 0; ky < p + 1 - kx; ++ky) {
+                    Real coefficient = std::sqrt((2.0L * kx + 1.0L) * (2.0L * ky + 1.0L)) / 2.0L;
+
+                    for(Natural a = 0; a < kx + 1; ++a)
+                        for(Natural b = 0; b < ky + 1; ++b) {
+                            const Real C_ab = coefficient * C(kx, a) * C(ky, b);
+
+                            if(C_ab == 0.0L)
+                                continue;
+
+                            phi(k, a * (p + 1) + b, C_ab);
+
+                            if(a > 0)
+                                gradx_phi(k, (a - 1) * (p + 1) + b, a * C_ab / h_x);
+
+                            if(b > 0)
+                                grady_phi(k, a * (p + 1) + b - 1, b * C_ab / h_y);
+                        }
+
+                    ++k;
+                }
+
+            if constexpr (constants::orthonormal) {
+                const Matrix<Real> Ct = internal::orthonormalization(mesh, j).transpose();
+                return {Ct * phi, Ct * gradx_phi, Ct * grady_phi};
+            }
+
+            return {phi, gradx_phi, grady_phi};
+        }
+
+        /**
+         * @brief Space basis' coefficients over the powers of an edge's parameter s in [0, 1].
+         * The edge is another element's, the basis is restricted to it.
+         * 
+         * @param mesh Mesh.
+         * @param i Evaluated element's index.
+         * @param j Edge's element's index.
+         * @param k Edge's index.
+         * @return std::array<Matrix<Real>, 3> Basis, x and y derivatives, one row per function.
+         */
+        std::array<Matrix<Real>, 3> monomials_edge(const Mesh21 &mesh, const Natural &i, const Natural &j, const Natural &k) {
+            auto [phi, gradx_phi, grady_phi] = internal::monomials_xy(mesh, i);
+
+            // Space degree.
+            const Natural p = mesh.element(i).p();
+
+            // Edge, in the evaluated element's box coordinates.
+            const auto [x_c, y_c, h_x, h_y] = mesh.cell(i).box();
+            const auto [O_x, O_y] = mesh.cell(j).origin(k);
+            const auto [D_x, D_y] = mesh.cell(j).direction(k);
+
+            const auto U = internal::powers((O_x - x_c) / h_x, D_x / h_x, p);
+            const auto V = internal::powers((O_y - y_c) / h_y, D_y / h_y, p);
+
+            // Restriction, xi^a eta^b to s powers, total degree up to p.
+            Matrix<Real> restriction{(p + 1) * (p + 1), p + 1};
+
+            for(Natural a = 0; a < p + 1; ++a)
+                for(Natural b = 0; b < p + 1 - a; ++b)
+                    for(Natural m = 0; m < a + 1; ++m)
+                        for(Natural n = 0; n < b + 1; ++n)
+                            restriction(a * (p + 1) + b, m + n, restriction(a * (p + 1) + b, m + n) + U[a][m] * V[b][n]);
+
+            return {phi * restriction, gradx_phi * restriction, grady_phi * restriction};
+        }
+
+        // Moments and exact products' integrals.
+
+        /**
+         * @brief Monomials' integrals over an element's base, xi^a eta^b in box coordinates, a + b up to a given degree.
+         * Divergence theorem, each moment reduces to exact edge integrals of polynomials.
+         * 
+         * @param mesh Mesh.
+         * @param j Element's index.
+         * @param degree Highest total degree.
+         * @return Matrix<Real> Entry (a, b) integrates xi^a eta^b.
+         */
+        Matrix<Real> moments_xy(const Mesh21 &mesh, const Natural &j, const Natural &degree) {
+
+            // Cell.
+            const Cell21 &cell = mesh.cell(j);
+            const auto [x_c, y_c, h_x, h_y] = cell.box();
+
+            Matrix<Real> moments{degree + 1, degree + 1};
+
+            for(Natural k = 0; k < cell.edges(); ++k) {
+                const auto [O_x, O_y] = cell.origin(k);
+                const auto [D_x, D_y] = cell.direction(k);
+
+                // Edge's parametrization, box coordinates.
+                const auto U = internal::powers((O_x - x_c) / h_x, D_x / h_x, degree + 1);
+                const auto V = internal::powers((O_y - y_c) / h_y, D_y / h_y, degree);
+
+                const Real D_eta = D_y / h_y;
+
+                // Green, xi^a eta^b = d/dxi (xi^(a + 1) eta^b / (a + 1)).
+                for(Natural a = 0; a < degree + 1; ++a)
+                    for(Natural b = 0; b < degree + 1 - a; ++b) {
+                        Real integral = 0.0L;
+
+                        for(Natural m = 0; m < a + 2; ++m)
+                            for(Natural n = 0; n < b + 1; ++n)
+                                integral += U[a + 1][m] * V[b][n] / static_cast<Real>(m + n + 1);
+
+                        moments(a, b, moments(a, b) + D_eta * integral / static_cast<Real>(a + 1));
+                    }
+            }
+
+            // Orientation and box's Jacobian.
+            const Real scale = ((moments(0, 0) < 0.0L) ? -1.0L : 1.0L) * h_x * h_y;
+
+            return scale * moments;
+        }
+
+        /**
+         * @brief Exact integrals of products over an element's base.
+         * 
+         * @param moments Element's moments, up to the sum of the degrees.
+         * @param L Left coefficients, monomials_xy layout.
+         * @param R Right coefficients, monomials_xy layout.
+         * @return Matrix<Real> Entry (j, h) integrates L_j R_h.
+         */
+        Matrix<Real> exact_xy(const Matrix<Real> &moments, const Matrix<Real> &L, const Matrix<Real> &R) {
+
+            // Monomials per direction.
+            const Natural l = static_cast<Natural>(std::llround(std::sqrt(static_cast<Real>(L.columns()))));
+            const Natural r = static_cast<Natural>(std::llround(std::sqrt(static_cast<Real>(R.columns()))));
+
+            #ifndef NDEBUG // Integrity check.
+            assert(l * l == L.columns());
+            assert(r * r == R.columns());
+            assert(moments.rows() + 1 >= l + r);
+            #endif
+
+            Matrix<Real> S{L.rows(), R.rows()};
+            Vector<Real> contraction{r * r};
+
+            for(Natural j = 0; j < L.rows(); ++j) {
+
+                // Left contraction against the moments.
+                for(Natural cd = 0; cd < r * r; ++cd)
+                    contraction(cd, 0.0L);
+
+                for(Natural a = 0; a < l; ++a)
+                    for(Natural b = 0; b < l; ++b) {
+                        const Real L_ab = L(j, a * l + b);
+
+                        if(L_ab == 0.0L)
+                            continue;
+
+                        for(Natural c = 0; c < r; ++c)
+                            for(Natural d = 0; d < r; ++d)
+                                if(a + b + c + d < moments.rows())
+                                    contraction(c * r + d, contraction(c * r + d) + L_ab * moments(a + c, b + d));
+                    }
+
+                // Right contraction.
+                for(Natural h = 0; h < R.rows(); ++h) {
+                    Real S_jh = 0.0L;
+
+                    for(Natural cd = 0; cd < r * r; ++cd)
+                        S_jh += contraction(cd) * R(h, cd);
+
+                    S(j, h, S_jh);
+                }
+            }
+
+            return S;
+        }
+
+        /**
+         * @brief Exact integrals of products over an edge.
+         * 
+         * @param length Edge's length.
+         * @param L Left coefficients, monomials_edge layout.
+         * @param R Right coefficients, monomials_edge layout.
+         * @return Matrix<Real> Entry (j, h) integrates L_j R_h.
+         */
+        Matrix<Real> exact_edge(const Real &length, const Matrix<Real> &L, const Matrix<Real> &R) {
+
+            // Hilbert matrix, s^m s^n over [0, 1].
+            Matrix<Real> H{L.columns(), R.columns()};
+
+            for(Natural m = 0; m < L.columns(); ++m)
+                for(Natural n = 0; n < R.columns(); ++n)
+                    H(m, n, 1.0L / static_cast<Real>(m + n + 1));
+
+            return length * (L * H * R.transpose());
+        }
+
+    }
+
+}
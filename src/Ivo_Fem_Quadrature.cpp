@@ -45,6 +45,10 @@ namespace ivo {
             assert(n % 2 == 1); // n must be odd.
             #endif
 
+            // Midpoint rule.
+            if(n == 1)
+                return {Vector<Real>{1, (a + b) / 2.0L}, Vector<Real>{1, b - a}};
+
             // Nodes to be computed.
             Natural m = (n + 1) / 2;
 
@@ -95,7 +99,7 @@ namespace ivo {
             mask(m - 1, false);
 
             // Nodes.
-            Vector<Real> nodes = ((b + a) / 2.0L) - ((b - a) / 2.0L) * stacked(z(mask), -flipped(z));
+            Vector<Real> nodes = ((b + a) / 2.0L) - ((b - a) / 2.0L) * stacked<Real>(z(mask), -flipped(z));
 
             // Reflection.
             Vector<Real> z_ref = stacked(z(mask), flipped(z));
@@ -107,6 +111,288 @@ namespace ivo {
             return {nodes, weights};
         }
 
+        /**
+         * @brief Collapsed Gauss-Legendre nodes and weights over the reference triangle {(0, 0), (0, 1), (1, 0)}.
+         * 
+         * @param n Order.
+         * @return std::array<Vector<Real>, 3> 
+         */
+        std::array<Vector<Real>, 3> gauss2(const Natural &n) {
+
+            // Square nodes and weights.
+            const auto &[nodes1, weights1] = quadrature1t(n);
+
+            // Temporary nodes and weights.
+            Vector<Real> nodes2_x{n * n};
+            Vector<Real> weights2_x{n * n};
+
+            Vector<Real> nodes2_y{n * n};
+            Vector<Real> weights2_y{n * n};
+
+            for(Natural j = 0; j < n; ++j)
+                for(Natural k = 0; k < n; ++k) {
+                
+                    // Nodes.
+                    nodes2_x(j * n + k, nodes1(j));
+                    nodes2_y(j * n + k, nodes1(k));
+
+                    // Weights.
+                    weights2_x(j * n + k, weights1(j));
+                    weights2_y(j * n + k, weights1(k));
+                }
+        
+            // Triangle nodes and weights.
+            Vector<Real> nodes2t_x = (1.0L + nodes2_x) / 2.0L;
+            Vector<Real> nodes2t_y = (1.0L - nodes2_x) * (1.0L + nodes2_y) / 4.0L;
+            Vector<Real> weights2t = (1.0L - nodes2_x) * weights2_x * weights2_y / 8.0L;
+
+            return {nodes2t_x, nodes2t_y, weights2t};
+        }
+
+        // Symmetric triangle rules.
+
+        /**
+         * @brief Symmetric rule over the reference triangle, by barycentric orbits.
+         * Weights sum to one.
+         * 
+         */
+        struct Symmetric {
+
+            /**
+             * @brief Exactness degree.
+             * 
+             */
+            Natural degree;
+
+            /**
+             * @brief Centroid's weight, zero if absent.
+             * 
+             */
+            Real centroid;
+
+            /**
+             * @brief (b, b, 1 - 2b) orbits, {b, weight}.
+             * 
+             */
+            std::vector<std::array<Real, 2>> s21;
+
+            /**
+             * @brief (a, b, 1 - a - b) orbits, {a, b, weight}.
+             * 
+             */
+            std::vector<std::array<Real, 3>> s111;
+        };
+
+        /**
+         * @brief Dunavant's rules with positive weights and interior nodes, refined at run time.
+         * 
+         * @return const std::vector<Symmetric>& 
+         */
+        const std::vector<Symmetric> &dunavant() {
+            static const std::vector<Symmetric> rules = {
+                {1, 1.0L, {}, {}},
+                {2, 0.0L, {{1.0L / 6.0L, 1.0L / 3.0L}}, {}},
+                {4, 0.0L, {{0.445948490915965L, 0.223381589678011L}, {0.091576213509771L, 0.109951743655322L}}, {}},
+                {5, 0.225L, {{0.470142064105115L, 0.132394152788506L}, {0.101286507323456L, 0.125939180544827L}}, {}},
+                {6, 0.0L, {{0.249286745170910L, 0.116786275726379L}, {0.063089014491502L, 0.050844906370207L}}, {{0.053145049844817L, 0.310352451033784L, 0.082851075618374L}}},
+                {8, 0.144315607677787L, {{0.459292588292723L, 0.095091634267285L}, {0.170569307751760L, 0.103217370534718L}, {0.050547228317031L, 0.032458497623198L}}, {{0.008394777409958L, 0.263112829634638L, 0.027230314174435L}}},
+                {9, 0.097135796282799L, {{0.489682519198738L, 0.031334700227139L}, {0.437089591492937L, 0.077827541004774L}, {0.188203535619033L, 0.079647738927210L}, {0.044729513394453L, 0.025577675658698L}}, {{0.036838412054736L, 0.221962989160766L, 0.043283539377289L}}}
+            };
+
+            return rules;
+        }
+
+        /**
+         * @brief Expands a symmetric rule over the reference triangle {(0, 0), (0, 1), (1, 0)}.
+         * 
+         * @param rule Symmetric rule.
+         * @return std::array<Vector<Real>, 3> 
+         */
+        std::array<Vector<Real>, 3> expanded(const Symmetric &rule) {
+            std::vector<Real> x, y, w;
+
+            if(rule.centroid != 0.0L) {
+                x.emplace_back(1.0L / 3.0L);
+                y.emplace_back(1.0L / 3.0L);
+                w.emplace_back(rule.centroid);
+            }
+
+            for(const auto &[b, weight]: rule.s21) {
+                const Real c = 1.0L - 2.0L * b;
+
+                x.insert(x.end(), {b, c, b});
+                y.insert(y.end(), {c, b, b});
+                w.insert(w.end(), 3, weight);
+            }
+
+            for(const auto &[a, b, weight]: rule.s111) {
+                const Real c = 1.0L - a - b;
+
+                x.insert(x.end(), {b, c, a, c, a, b});
+                y.insert(y.end(), {c, b, c, a, b, a});
+                w.insert(w.end(), 6, weight);
+            }
+
+            Vector<Real> nodes_x{x.size()}, nodes_y{y.size()}, weights{w.size()};
+
+            for(Natural j = 0; j < w.size(); ++j) {
+                nodes_x(j, x[j]);
+                nodes_y(j, y[j]);
+                weights(j, 0.5L * w[j]);
+            }
+
+            return {nodes_x, nodes_y, weights};
+        }
+
+        /**
+         * @brief Monomials' residuals, sum(w x^i y^j) - i! j! / (i + j + 2)!, i + j <= degree.
+         * 
+         * @param rule Symmetric rule.
+         * @return Vector<Real> 
+         */
+        Vector<Real> residuals(const Symmetric &rule) {
+            const auto [nodes_x, nodes_y, weights] = internal::expanded(rule);
+            const Natural monomials = (rule.degree + 1) * (rule.degree + 2) / 2;
+
+            Vector<Real> residual{monomials};
+            Natural index = 0;
+
+            for(Natural i = 0; i <= rule.degree; ++i)
+                for(Natural j = 0; i + j <= rule.degree; ++j) {
+                    Real integral = 0.0L;
+
+                    for(Natural k = 0; k < weights.size(); ++k)
+                        integral += weights(k) * std::pow(nodes_x(k), i) * std::pow(nodes_y(k), j);
+
+                    residual(index++, integral - std::tgamma(i + 1.0L) * std::tgamma(j + 1.0L) / std::tgamma(i + j + 3.0L));
+                }
+
+            return residual;
+        }
+
+        /**
+         * @brief Refines a tabulated symmetric rule, moments' residual within constants::quadrature_zero.
+         * Gauss-Newton over the moment equations, finite-difference Jacobian.
+         * 
+         * @param rule Symmetric rule.
+         * @return Symmetric 
+         */
+        Symmetric refined(Symmetric rule) {
+
+            // Parameters.
+            std::vector<Real *> parameters;
+
+            if(rule.centroid != 0.0L)
+                parameters.emplace_back(&rule.centroid);
+
+            for(auto &orbit: rule.s21)
+                for(auto &entry: orbit)
+                    parameters.emplace_back(&entry);
+
+            for(auto &orbit: rule.s111)
+                for(auto &entry: orbit)
+                    parameters.emplace_back(&entry);
+
+            const Real step = 1E-7L;
+
+            for(Natural iteration = 0; iteration < constants::symmetric_iterations; ++iteration) {
+                const Vector<Real> residual = internal::residuals(rule);
+
+                if(norm(residual) <= constants::quadrature_zero)
+                    break;
+
+                // Jacobian.
+                Matrix<Real> J{residual.size(), parameters.size()};
+
+                for(Natural k = 0; k < parameters.size(); ++k) {
+                    const Real value = *parameters[k];
+
+                    *parameters[k] = value + step;
+                    const Vector<Real> forward = internal::residuals(rule);
+
+                    *parameters[k] = value - step;
+                    const Vector<Real> backward = internal::residuals(rule);
+
+                    *parameters[k] = value;
+                    J.column(k, (forward - backward) / (2.0L * step));
+                }
+
+                // Update.
+                const Vector<Real> update = QR<Real>{J}.solve(residual);
+
+                for(Natural k = 0; k < parameters.size(); ++k)
+                    *parameters[k] -= update(k);
+            }
+
+            #ifndef NDEBUG // Integrity check.
+            assert(norm(internal::residuals(rule)) <= constants::quadrature_zero);
+            #endif
+
+            return rule;
+        }
+
+        // Rules' registry.
+
+        /**
+         * @brief Process-wide rule of a given odd order.
+         * Every order up to constants::quadrature_max is built once, on first use, on the heap.
+         * Higher orders are built on demand and cached alike.
+         * 
+         * @tparam S Rule's size.
+         * @tparam F Builder.
+         * @param n Order.
+         * @param build Builder.
+         * @return const std::array<Vector<Real>, S>& 
+         */
+        template<Natural S, typename F>
+        const std::array<Vector<Real>, S> &rule(const Natural &n, const F &build) {
+            #ifndef NDEBUG // Integrity check.
+            assert(n % 2 == 1); // n must be odd.
+            #endif
+
+            // Thread-safe initialization.
+            static const std::vector<std::array<Vector<Real>, S>> rules = [&build]() {
+                internal::Scope scope{internal::heap()};
+                std::vector<std::array<Vector<Real>, S>> rules;
+
+                for(Natural order = 1; order <= constants::quadrature_max; order += 2)
+                    rules.emplace_back(build(order));
+
+                return rules;
+            }();
+
+            if(n <= constants::quadrature_max)
+                return rules[(n - 1) / 2];
+
+            // Higher orders.
+            static std::map<Natural, std::array<Vector<Real>, S>> extra;
+            static std::mutex lock;
+
+            {
+                std::lock_guard<std::mutex> guard{lock};
+
+                if(auto entry = extra.find(n); entry != extra.end())
+                    return entry->second;
+            }
+
+            internal::Scope scope{internal::heap()};
+            auto rule = build(n);
+
+            std::lock_guard<std::mutex> guard{lock};
+            return extra.try_emplace(n, std::move(rule)).first->second;
+        }
+
+        /**
+         * @brief Smallest tabulated order exact up to a given degree.
+         * 
+         * @param degree Exactness degree.
+         * @return Natural 
+         */
+        Natural order(const Natural &degree) {
+            const Natural n = degree / 2 + 1; // Exact up to 2n - 1.
+            return n + 1 - n % 2;
+        }
+
     }
 
     // Gauss-Legendre nodes and weights over reference structures.
@@ -115,54 +401,254 @@ namespace ivo {
      * @brief Gauss-Legendre nodes and weights over the reference interval [-1, 1].
      * 
      * @param n Order.
-     * @return std::array<Vector<Real>, 2> 
+     * @return const std::array<Vector<Real>, 2>& 
      */
-    std::array<Vector<Real>, 2> quadrature1t(const Natural &n) { return internal::gauss1(n, -1.0L, 1.0L); }
+    const std::array<Vector<Real>, 2> &quadrature1t(const Natural &n) {
+        return internal::rule<2>(n, [](const Natural &order){ return internal::gauss1(order, -1.0L, 1.0L); });
+    }
 
     /**
      * @brief Gauss-Legendre nodes and weights over the reference interval [0, 1].
      * 
      * @param n Order.
-     * @return std::array<Vector<Real>, 2> 
+     * @return const std::array<Vector<Real>, 2>& 
      */
-    std::array<Vector<Real>, 2> quadrature1x(const Natural &n) { return internal::gauss1(n, 0.0L, 1.0L); }
+    const std::array<Vector<Real>, 2> &quadrature1x(const Natural &n) {
+        return internal::rule<2>(n, [](const Natural &order){ return internal::gauss1(order, 0.0L, 1.0L); });
+    }
 
     /**
      * @brief Gauss-Legendre nodes and weights over the reference triangle {(0, 0), (0, 1), (1, 0)}.
      * 
-     * @param n 
-     * @return std::array<Vector<Real>, 3> 
+     * @param n Order.
+     * @return const std::array<Vector<Real>, 3>& 
      */
-    std::array<Vector<Real>, 3> quadrature2xy(const Natural &n) {
+    const std::array<Vector<Real>, 3> &quadrature2xy(const Natural &n) {
+        return internal::rule<3>(n, [](const Natural &order){ return internal::gauss2(order); });
+    }
 
-        // Square nodes and weights.
-        auto [nodes1, weights1] = quadrature1t(n);
+    /**
+     * @brief Symmetric nodes and weights over the reference triangle {(0, 0), (0, 1), (1, 0)}.
+     * Smallest tabulated rule exact up to the given degree, collapsed Gauss-Legendre rules beyond the table.
+     * 
+     * @param degree Exactness degree.
+     * @return const std::array<Vector<Real>, 3>& 
+     */
+    const std::array<Vector<Real>, 3> &symmetric2xy(const Natural &degree) {
+        const std::vector<internal::Symmetric> &table = internal::dunavant();
 
-        // Temporary nodes and weights.
-        Vector<Real> nodes2_x{n * n};
-        Vector<Real> weights2_x{n * n};
+        // Collapsed rules, exact up to 2n - 2.
+        if(degree > table.back().degree) {
+            const Natural n = (degree + 3) / 2;
+            return quadrature2xy(n + 1 - n % 2);
+        }
 
-        Vector<Real> nodes2_y{n * n};
-        Vector<Real> weights2_y{n * n};
+        // Thread-safe initialization.
+        static const std::vector<std::array<Vector<Real>, 3>> rules = [&table]() {
+            internal::Scope scope{internal::heap()};
+            std::vector<std::array<Vector<Real>, 3>> rules;
 
-        for(Natural j = 0; j < n; ++j)
-            for(Natural k = 0; k < n; ++k) {
-                
-                // Nodes.
-                nodes2_x(j * n + k, nodes1(j));
-                nodes2_y(j * n + k, nodes1(k));
+            for(const auto &rule: table)
+                rules.emplace_back(internal::expanded(internal::refined(rule)));
 
-                // Weights.
-                weights2_x(j * n + k, weights1(j));
-                weights2_y(j * n + k, weights1(k));
+            return rules;
+        }();
+
+        Natural index = 0;
+
+        while(table[index].degree < degree)
+            ++index;
+
+        return rules[index];
+    }
+
+    namespace internal {
+
+        // Polygon-native nodes and weights.
+
+        /**
+         * @brief Compressed nodes and weights over an element's base, exact up to a given degree.
+         * Moment fitting: the sub-triangulated symmetric rule is compressed by non-negative least squares against
+         * a tensor Legendre basis over the bounding box, to at most (d + 1)(d + 2) / 2 nodes with positive weights.
+         * The node count does not depend on the number of edges. The sub-triangulated rule is kept if compression fails.
+         * 
+         * @param mesh Mesh.
+         * @param j Element's index.
+         * @param degree Exactness degree.
+         * @return std::tuple<std::array<Vector<Real>, 2>, Vector<Real>> 
+         */
+        std::tuple<std::array<Vector<Real>, 2>, Vector<Real>> compressed_quadrature(const Mesh21 &mesh, const Natural &j, const Natural &degree) {
+
+            // Cell.
+            const Cell21 &cell = mesh.cell(j);
+            const Natural triangles = cell.triangles();
+
+            // Sub-triangulated rule.
+            const auto &[nodes2x, nodes2y, weights2] = symmetric2xy(degree);
+            const Natural points = weights2.size();
+
+            Vector<Real> x{triangles * points}, y{triangles * points}, w{triangles * points};
+
+            for(Natural k = 0; k < triangles; ++k) {
+                auto [nodes2xy_k, dxy_k] = internal::reference_to_element(mesh, j, k, {nodes2x, nodes2y});
+
+                for(Natural h = 0; h < points; ++h) {
+                    x(k * points + h, nodes2xy_k[0](h));
+                    y(k * points + h, nodes2xy_k[1](h));
+                    w(k * points + h, weights2(h) * dxy_k);
+                }
             }
-        
-        // Triangle nodes and weights.
-        Vector<Real> nodes2t_x = (1.0L + nodes2_x) / 2.0L;
-        Vector<Real> nodes2t_y = (1.0L - nodes2_x) * (1.0L + nodes2_y) / 4.0L;
-        Vector<Real> weights2t = (1.0L - nodes2_x) * weights2_x * weights2_y / 8.0L;
 
-        return {nodes2t_x, nodes2t_y, weights2t};
+            const Natural nodes = x.size();
+            const Natural monomials = (degree + 1) * (degree + 2) / 2;
+
+            if(nodes <= monomials)
+                return {{x, y}, w};
+
+            // Box.
+            const auto [x_c, y_c, h_x, h_y] = cell.box();
+
+            const Vector<Real> u = (x - x_c) / h_x;
+            const Vector<Real> v = (y - y_c) / h_y;
+
+            const auto [Pu, dPu] = internal::legendres(u, degree);
+            const auto [Pv, dPv] = internal::legendres(v, degree);
+
+            // Basis over the nodes, one row per node.
+            Matrix<Real> V{nodes, monomials};
+
+            for(Natural h = 0; h < nodes; ++h) {
+                Natural index = 0;
+
+                for(Natural a = 0; a <= degree; ++a)
+                    for(Natural b = 0; a + b <= degree; ++b)
+                        V(h, index++, Pu(a, h) * Pv(b, h));
+            }
+
+            // Moments.
+            const Vector<Real> moments = w * V;
+
+            // Lawson-Hanson non-negative least squares, V^T w = moments, w >= 0.
+            const Real tolerance = constants::quadrature_zero * norm(moments);
+
+            Vector<Real> weights{nodes};
+            std::vector<Natural> passive;
+            std::vector<bool> active(nodes, true);
+
+            for(Natural iteration = 0; iteration < 3 * monomials; ++iteration) {
+                const Vector<Real> residual = moments - weights * V;
+
+                if(norm(residual) <= tolerance)
+                    break;
+
+                // Most violated node.
+                const Vector<Real> gradient = V * residual;
+
+                Natural entering = nodes;
+                Real largest = tolerance;
+
+                for(Natural h = 0; h < nodes; ++h)
+                    if(active[h] && (gradient(h) > largest)) {
+                        largest = gradient(h);
+                        entering = h;
+                    }
+
+                if(entering == nodes)
+                    break;
+
+                passive.emplace_back(entering);
+                active[entering] = false;
+
+                // Inner loop, feasibility.
+                while(!passive.empty()) {
+                    Matrix<Real> V_P{monomials, passive.size()};
+
+                    for(Natural k = 0; k < passive.size(); ++k)
+                        for(Natural r = 0; r < monomials; ++r)
+                            V_P(r, k, V(passive[k], r));
+
+                    const Vector<Real> z = QR<Real>{V_P}.solve(moments);
+
+                    if(min(z) > 0.0L) {
+                        for(Natural k = 0; k < passive.size(); ++k)
+                            weights(passive[k], z(k));
+
+                        break;
+                    }
+
+                    // Step back to the feasible region.
+                    Real alpha = 1.0L;
+
+                    for(Natural k = 0; k < passive.size(); ++k)
+                        if(z(k) <= 0.0L)
+                            alpha = std::min(alpha, weights(passive[k]) / (weights(passive[k]) - z(k)));
+
+                    std::vector<Natural> kept;
+
+                    for(Natural k = 0; k < passive.size(); ++k) {
+                        const Real updated = weights(passive[k]) + alpha * (z(k) - weights(passive[k]));
+
+                        if(updated > constants::zero) {
+                            weights(passive[k], updated);
+                            kept.emplace_back(passive[k]);
+                        } else {
+                            weights(passive[k], 0.0L);
+                            active[passive[k]] = true;
+                        }
+                    }
+
+                    passive = kept;
+                }
+            }
+
+            // Exactness and compression check.
+            if((norm(moments - weights * V) > tolerance) || (passive.size() >= nodes))
+                return {{x, y}, w};
+
+            Vector<Real> x_S{passive.size()}, y_S{passive.size()}, w_S{passive.size()};
+
+            for(Natural s = 0; s < passive.size(); ++s) {
+                x_S(s, x(passive[s]));
+                y_S(s, y(passive[s]));
+                w_S(s, weights(passive[s]));
+            }
+
+            return {{x_S, y_S}, w_S};
+        }
+
+        /**
+         * @brief Polygon-native nodes and weights over an element's base, exact up to a given degree.
+         * Rules are compressed once per distinct polygon and degree, then cached process-wide on the heap.
+         * Space-time elements sharing a base share the rule.
+         * 
+         * @param mesh Mesh.
+         * @param j Element's index.
+         * @param degree Exactness degree.
+         * @return std::tuple<std::array<Vector<Real>, 2>, Vector<Real>> 
+         */
+        std::tuple<std::array<Vector<Real>, 2>, Vector<Real>> polygon_quadrature(const Mesh21 &mesh, const Natural &j, const Natural &degree) {
+            static std::map<std::vector<Real>, std::tuple<std::array<Vector<Real>, 2>, Vector<Real>>> rules;
+            static std::mutex lock;
+
+            // Key, degree and cell's vertices.
+            std::vector<Real> key{static_cast<Real>(degree)};
+            key.insert(key.end(), mesh.cell(j).vertices().begin(), mesh.cell(j).vertices().end());
+
+            {
+                std::lock_guard<std::mutex> guard{lock};
+
+                if(auto rule = rules.find(key); rule != rules.end())
+                    return rule->second;
+            }
+
+            // Compression, outside of any arena.
+            internal::Scope scope{internal::heap()};
+            auto rule = internal::compressed_quadrature(mesh, j, degree);
+
+            std::lock_guard<std::mutex> guard{lock};
+            return rules.try_emplace(key, std::move(rule)).first->second;
+        }
+
     }
 
-}
\ No newline at end of file
+}
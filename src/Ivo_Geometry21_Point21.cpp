@@ -64,6 +64,13 @@ namespace ivo {
      */
     Point21::operator Vector<Real>() const { return Vector<Real>{{this->_x, this->_y, this->_t}}; }
 
+    /**
+     * @brief Fixed-size vector conversion.
+     * 
+     * @return Vector<Real, 3> 
+     */
+    Point21::operator Vector<Real, 3>() const { return Vector<Real, 3>{this->_x, this->_y, this->_t}; }
+
     // Comparison.
 
     /**
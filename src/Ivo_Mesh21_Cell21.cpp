@@ -0,0 +1,72 @@
+/**
+ * @file Mesh21_Cell21.cpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Mesh21/Cell21.hpp implementation.
+ * @date 2024-11-04
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <Ivo.hpp>
+
+namespace ivo {
+
+    // Constructors.
+
+    /**
+     * @brief Default constructor.
+     * 
+     * @param polygon Space cell.
+     */
+    Cell21::Cell21(const Polygon21 &polygon) {
+
+        // Vertices.
+        for(const auto &point: polygon.points()) {
+            this->_vertices.emplace_back(point(0));
+            this->_vertices.emplace_back(point(1));
+        }
+
+        // Sub-triangles.
+        for(const auto &triangle: triangulate(polygon)) {
+            const Real J_00 = triangle(1)(0) - triangle(0)(0);
+            const Real J_01 = triangle(2)(0) - triangle(0)(0);
+            const Real J_10 = triangle(1)(1) - triangle(0)(1);
+            const Real J_11 = triangle(2)(1) - triangle(0)(1);
+
+            this->_jacobians[0].emplace_back(J_00);
+            this->_jacobians[1].emplace_back(J_01);
+            this->_jacobians[2].emplace_back(J_10);
+            this->_jacobians[3].emplace_back(J_11);
+
+            this->_translations[0].emplace_back(triangle(0)(0));
+            this->_translations[1].emplace_back(triangle(0)(1));
+
+            this->_determinants.emplace_back(J_00 * J_11 - J_01 * J_10);
+        }
+
+        // Edges.
+        for(const auto &edge: polygon.edges()) {
+            const Real d_x = edge(1)(0) - edge(0)(0);
+            const Real d_y = edge(1)(1) - edge(0)(1);
+            const Real length = distance(edge(0), edge(1));
+
+            this->_origins[0].emplace_back(edge(0)(0));
+            this->_origins[1].emplace_back(edge(0)(1));
+
+            this->_directions[0].emplace_back(d_x);
+            this->_directions[1].emplace_back(d_y);
+
+            this->_normals[0].emplace_back(d_y / length);
+            this->_normals[1].emplace_back(-d_x / length);
+
+            this->_lengths.emplace_back(length);
+        }
+
+        // Bounding box.
+        auto [xy_min, xy_max] = box2(polygon);
+
+        this->_box = {0.5L * (xy_max(0) + xy_min(0)), 0.5L * (xy_max(1) + xy_min(1)), 0.5L * (xy_max(0) - xy_min(0)), 0.5L * (xy_max(1) - xy_min(1))};
+    }
+
+}
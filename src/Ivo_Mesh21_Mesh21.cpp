@@ -22,7 +22,7 @@ namespace ivo {
      * @param p Space degree.
      * @param q Time degree.
      */
-    Mesh21::Mesh21(const std::vector<Polygon21> &cells, const std::vector<Real> &intervals, const Natural &p, const Natural &q): _space{cells.size()}, _time{intervals.size() - 1} {
+    Mesh21::Mesh21(const std::vector<Polygon21> &cells, const std::vector<Real> &intervals, const Natural &p, const Natural &q): _space{cells.size()}, _time{intervals.size() - 1}, _intervals{intervals} {
         
         #ifndef NVERBOSE
         std::cout << "[Ivo] Mesh21" << std::endl;
@@ -40,6 +40,22 @@ namespace ivo {
                 this->_elements.emplace_back(Element21{Polygon21{points}, intervals[j + 1] - intervals[j], p, q});
             }
 
+        #ifndef NVERBOSE
+        std::cout << "\t[Mesh21] Evaluating geometry" << std::endl;
+        #endif
+
+        // Geometry, once per space cell.
+        std::vector<std::optional<Cell21>> geometry(this->_space);
+
+        #pragma omp parallel for
+        for(Natural k = 0; k < this->_space; ++k)
+            geometry[k].emplace(cells[k]);
+
+        this->_cells.reserve(this->_space);
+
+        for(auto &cell: geometry)
+            this->_cells.emplace_back(std::move(*cell));
+
         #ifndef NVERBOSE
         std::cout << "\t[Mesh21] Evaluating neighbours" << std::endl;
         #endif
@@ -20,7 +20,8 @@ namespace ivo {
      * @param source Source.
      * @param dirichlet Dirichlet boundary condition.
      * @param neumann Neumann boundary condition.
+     * @param degree Data's extra quadrature degree.
      */
-    Data::Data(const std::function<Real (Real, Real, Real)> &source, const std::function<Real (Real, Real, Real)> &dirichlet, const std::function<Real (Real, Real, Real)> &neumann): _source{source}, _dirichlet{dirichlet}, _neumann{neumann} {}
+    Data::Data(const std::function<Real (Real, Real, Real)> &source, const std::function<Real (Real, Real, Real)> &dirichlet, const std::function<Real (Real, Real, Real)> &neumann, const Natural &degree): _source{source}, _dirichlet{dirichlet}, _neumann{neumann}, _degree{degree} {}
     
 }
\ No newline at end of file
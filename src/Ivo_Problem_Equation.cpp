@@ -20,7 +20,8 @@ namespace ivo {
      * @param convection Convection coefficient.
      * @param diffusion Diffusion coefficient.
      * @param reaction Reaction coefficient.
+     * @param degree Coefficients' extra quadrature degree.
      */
-    Equation::Equation(const std::function<std::array<Real, 2> (Real, Real, Real)> &convection, const Real &diffusion, const std::function<Real (Real, Real, Real)> &reaction): _convection{convection}, _diffusion{diffusion}, _reaction{reaction} {}
+    Equation::Equation(const std::function<std::array<Real, 2> (Real, Real, Real)> &convection, const Real &diffusion, const std::function<Real (Real, Real, Real)> &reaction, const Natural &degree): _convection{convection}, _diffusion{diffusion}, _reaction{reaction}, _degree{degree} {}
 
 }
\ No newline at end of file
@@ -28,10 +28,6 @@ namespace ivo {
             // Error.
             Real l2 = 0.0L;
 
-            // Quadrature.
-            auto [nodes1x, weights1x] = quadrature1x(constants::quadrature);
-            auto [nodes2x, nodes2y, weights2] = quadrature2xy(constants::quadrature);
-
             // Time index and ratio.
             Natural i = 0;
 
@@ -39,11 +35,8 @@ namespace ivo {
 
                 // ELEMENT DATA.
 
-                // Element.
-                Element21 element = mesh.element(j);
-
                 // Time interval.
-                auto [t0, t1] = element.interval();
+                auto [t0, t1] = mesh.interval(j);
 
                 if((t >= t0) && (t < t1)) {
                     i = j / mesh.space();
@@ -55,62 +48,40 @@ namespace ivo {
             // Loop over elements.
             for(Natural j = mesh.space() * i; j < mesh.space() * (i + 1); ++j) {
 
-                // ELEMENT DATA.
+                // Element's temporaries, thread's arena.
+                internal::Scope scope;
 
-                // Element.
-                Element21 element = mesh.element(j);
+                // ELEMENT DATA.
 
                 // Dofs.
                 std::vector<Natural> dofs_j = mesh.dofs(j);
-                Natural dofs_xy = (element.p() + 1) * (element.p() + 2) / 2;
-                Natural dofs_t = element.q() + 1;
-
-                // Neighbours.
-                Neighbour21 neighbourhood = mesh.neighbour(j);
-
-                std::vector<std::array<Integer, 2>> facing = neighbourhood.facing();
-                Natural neighbours = facing.size();
 
                 // Nodes and basis, time.
                 auto [phi_t, gradt_phi_t] = basis_t(mesh, j, Vector<Real>(1, t));
 
                 // INTEGRALS - COMPUTING.
 
-                for(Natural k = 0; k < neighbours; ++k) { // Sub-triangulation.
-
-                    // Nodes and basis, space.
-                    auto [nodes2xy_j, dxy_j] = internal::reference_to_element(mesh, j, k, {nodes2x, nodes2y});
-                    auto [phi_xy, gradx_phi_xy, grady_phi_xy] = basis_xy(mesh, j, nodes2xy_j);
-                    auto [nodes2x, nodes2y] = nodes2xy_j;
+                // Nodes and weights, space, polygon-native.
+                auto [nodes2xy_j, weights2_j] = internal::polygon_quadrature(mesh, j, constants::quadrature_degree);
 
-                    // Weights, space.
-                    Vector<Real> weights2_j = weights2 * dxy_j;
-
-                    // Local coefficients and solution.
-                    Vector<Real> u_j = uh(dofs_j);
-
-                    Matrix<Real> uh_j{phi_t.rows(), phi_xy.rows()};
-
-                    for(Natural kxy = 0; kxy < phi_xy.rows(); ++kxy) {
-                        Real uh_xyt = 0.0;
+                // Basis, space.
+                auto [phi_xy, gradx_phi_xy, grady_phi_xy] = internal::tabulated_xy(mesh, j, constants::quadrature_degree);
+                auto [nodes2x, nodes2y] = nodes2xy_j;
 
-                        for(Natural jt = 0; jt < dofs_t; ++jt)
-                            for(Natural jxy = 0; jxy < dofs_xy; ++jxy)
-                                uh_xyt += phi_t(0, jt) * phi_xy(kxy, jxy) * u_j(jt * dofs_xy + jxy);
+                // Local coefficients and solution.
+                Vector<Real> u_j = uh(dofs_j);
 
-                        uh_j(0, kxy, uh_xyt);
-                    }
+                Matrix<Real> uh_j = internal::evaluated(phi_t, phi_xy, u_j);
 
-                    // CURRENT ERROR.
+                // CURRENT ERROR.
 
-                    for(Natural kxy = 0; kxy < phi_xy.rows(); ++kxy) { // Brute-force integral.
-                        Real x = nodes2x[kxy];
-                        Real y = nodes2y[kxy];
+                for(Natural kxy = 0; kxy < phi_xy.rows(); ++kxy) { // Brute-force integral.
+                    Real x = nodes2x[kxy];
+                    Real y = nodes2y[kxy];
 
-                        // L2 error.
+                    // L2 error.
 
-                        l2 += weights2_j(kxy) * (u(x, y, t) - uh_j(0, kxy)) * (u(x, y, t) - uh_j(0, kxy));
-                    }
+                    l2 += weights2_j(kxy) * (u(x, y, t) - uh_j(0, kxy)) * (u(x, y, t) - uh_j(0, kxy));
                 }
             }
 
@@ -143,9 +114,7 @@ namespace ivo {
         this->linfl2 = 0.0L;
 
         // Quadrature.
-        auto [nodes1t, weights1t] = quadrature1t(constants::quadrature);
-        auto [nodes1x, weights1x] = quadrature1x(constants::quadrature);
-        auto [nodes2x, nodes2y, weights2] = quadrature2xy(constants::quadrature);
+        const auto &[nodes1t, weights1t] = quadrature1t(constants::quadrature);
 
         #ifndef NVERBOSE
         std::cout << "[Ivo] Error" << std::endl;
@@ -155,21 +124,13 @@ namespace ivo {
         // Loop over elements.
         for(Natural j = 0; j < mesh.space() * mesh.time(); ++j) {
 
-            // ELEMENT DATA.
+            // Element's temporaries, thread's arena.
+            internal::Scope scope;
 
-            // Element.
-            Element21 element = mesh.element(j);
+            // ELEMENT DATA.
 
             // Dofs.
             std::vector<Natural> dofs_j = mesh.dofs(j);
-            Natural dofs_xy = (element.p() + 1) * (element.p() + 2) / 2;
-            Natural dofs_t = element.q() + 1;
-
-            // Neighbours.
-            Neighbour21 neighbourhood = mesh.neighbour(j);
-
-            std::vector<std::array<Integer, 2>> facing = neighbourhood.facing();
-            Natural neighbours = facing.size();
 
             // Nodes and basis, time.
             auto [nodes1t_j, dt_j] = internal::reference_to_element(mesh, j, nodes1t);
@@ -180,62 +141,40 @@ namespace ivo {
 
             // VOLUME INTEGRALS - COMPUTING.
 
-            for(Natural k = 0; k < neighbours; ++k) { // Sub-triangulation.
-
-                // Nodes and basis, space.
-                auto [nodes2xy_j, dxy_j] = internal::reference_to_element(mesh, j, k, {nodes2x, nodes2y});
-                auto [phi_xy, gradx_phi_xy, grady_phi_xy] = basis_xy(mesh, j, nodes2xy_j);
-                auto [nodes2x, nodes2y] = nodes2xy_j;
-
-                // Weights, space.
-                Vector<Real> weights2_j = weights2 * dxy_j;
+            // Nodes and weights, space, polygon-native.
+            auto [nodes2xy_j, weights2_j] = internal::polygon_quadrature(mesh, j, constants::quadrature_degree);
 
-                // Local coefficients and solution.
-                Vector<Real> u_j = uh(dofs_j);
+            // Basis, space.
+            auto [phi_xy, gradx_phi_xy, grady_phi_xy] = internal::tabulated_xy(mesh, j, constants::quadrature_degree);
+            auto [nodes2x, nodes2y] = nodes2xy_j;
 
-                Matrix<Real> uh_j{phi_t.rows(), phi_xy.rows()};
-                Matrix<Real> uh_x_j{phi_t.rows(), phi_xy.rows()};
-                Matrix<Real> uh_y_j{phi_t.rows(), phi_xy.rows()};
+            // Local coefficients and solution.
+            Vector<Real> u_j = uh(dofs_j);
 
-                for(Natural kt = 0; kt < phi_t.rows(); ++kt)
-                    for(Natural kxy = 0; kxy < phi_xy.rows(); ++kxy) {
-                        Real uh_xyt = 0.0;
-                        Real uh_x_xyt = 0.0;
-                        Real uh_y_xyt = 0.0;
+            Matrix<Real> uh_j = internal::evaluated(phi_t, phi_xy, u_j);
+            Matrix<Real> uh_x_j = internal::evaluated(phi_t, gradx_phi_xy, u_j);
+            Matrix<Real> uh_y_j = internal::evaluated(phi_t, grady_phi_xy, u_j);
 
-                        for(Natural jt = 0; jt < dofs_t; ++jt)
-                            for(Natural jxy = 0; jxy < dofs_xy; ++jxy) {
-                                uh_xyt += phi_t(kt, jt) * phi_xy(kxy, jxy) * u_j(jt * dofs_xy + jxy);
-                                uh_x_xyt += phi_t(kt, jt) * gradx_phi_xy(kxy, jxy) * u_j(jt * dofs_xy + jxy);
-                                uh_y_xyt += phi_t(kt, jt) * grady_phi_xy(kxy, jxy) * u_j(jt * dofs_xy + jxy);
-                            }
+            // CURRENT ERROR.
 
-                        uh_j(kt, kxy, uh_xyt);
-                        uh_x_j(kt, kxy, uh_x_xyt);
-                        uh_y_j(kt, kxy, uh_y_xyt);
-                    }
-
-                // CURRENT ERROR.
-
-                for(Natural kt = 0; kt < phi_t.rows(); ++kt)
-                    for(Natural kxy = 0; kxy < phi_xy.rows(); ++kxy) { // Brute-force integral.
-                        Real x = nodes2x[kxy];
-                        Real y = nodes2y[kxy];
-                        Real t = nodes1t_j[kt];
+            for(Natural kt = 0; kt < phi_t.rows(); ++kt)
+                for(Natural kxy = 0; kxy < phi_xy.rows(); ++kxy) { // Brute-force integral.
+                    Real x = nodes2x[kxy];
+                    Real y = nodes2y[kxy];
+                    Real t = nodes1t_j[kt];
 
-                        // Gradient.
-                        auto [u_x, u_y] = u_xy(x, y, t);
+                    // Gradient.
+                    auto [u_x, u_y] = u_xy(x, y, t);
 
-                        // L2(L2) error.
+                    // L2(L2) error.
 
-                        this->l2l2s[j] += weights2_j(kxy) * weights1t_j(kt) * (u(x, y, t) - uh_j(kt, kxy)) * (u(x, y, t) - uh_j(kt, kxy));
+                    this->l2l2s[j] += weights2_j(kxy) * weights1t_j(kt) * (u(x, y, t) - uh_j(kt, kxy)) * (u(x, y, t) - uh_j(kt, kxy));
 
-                        // L2(H1) error.
+                    // L2(H1) error.
 
-                        this->l2h1s[j] += weights2_j(kxy) * weights1t_j(kt) * (u_x - uh_x_j(kt, kxy)) * (u_x - uh_x_j(kt, kxy));
-                        this->l2h1s[j] += weights2_j(kxy) * weights1t_j(kt) * (u_y - uh_y_j(kt, kxy)) * (u_y - uh_y_j(kt, kxy));
-                    }
-            }
+                    this->l2h1s[j] += weights2_j(kxy) * weights1t_j(kt) * (u_x - uh_x_j(kt, kxy)) * (u_x - uh_x_j(kt, kxy));
+                    this->l2h1s[j] += weights2_j(kxy) * weights1t_j(kt) * (u_y - uh_y_j(kt, kxy)) * (u_y - uh_y_j(kt, kxy));
+                }
 
             // Error update.
             this->l2h1s[j] *= equation.diffusion();
@@ -256,69 +195,47 @@ namespace ivo {
         // Loop over last elements.
         for(Natural j = mesh.space() * (mesh.time() - 1); j < mesh.space() * mesh.time(); ++j) {
 
+            // Element's temporaries, thread's arena.
+            internal::Scope scope;
+
             // Index.
             Natural i = j - mesh.space() * (mesh.time() - 1);
 
             // ELEMENT DATA.
 
-            // Element.
-            Element21 element = mesh.element(j);
-
             // Dofs.
             std::vector<Natural> dofs_j = mesh.dofs(j);
-            Natural dofs_xy = (element.p() + 1) * (element.p() + 2) / 2;
-            Natural dofs_t = element.q() + 1;
-
-            // Neighbours.
-            Neighbour21 neighbourhood = mesh.neighbour(j);
-
-            std::vector<std::array<Integer, 2>> facing = neighbourhood.facing();
-            Natural neighbours = facing.size();
 
             // Time interval.
-            std::array<Real, 2> interval = element.interval();
+            std::array<Real, 2> interval = mesh.interval(j);
 
             // Nodes and basis, time.
             auto [phi_t, gradt_phi_t] = basis_t(mesh, j, Vector<Real>(1, interval[1]));
 
             // INTEGRALS - COMPUTING.
 
-            for(Natural k = 0; k < neighbours; ++k) { // Sub-triangulation.
+            // Nodes and weights, space, polygon-native.
+            auto [nodes2xy_j, weights2_j] = internal::polygon_quadrature(mesh, j, constants::quadrature_degree);
 
-                // Nodes and basis, space.
-                auto [nodes2xy_j, dxy_j] = internal::reference_to_element(mesh, j, k, {nodes2x, nodes2y});
-                auto [phi_xy, gradx_phi_xy, grady_phi_xy] = basis_xy(mesh, j, nodes2xy_j);
-                auto [nodes2x, nodes2y] = nodes2xy_j;
+            // Basis, space.
+            auto [phi_xy, gradx_phi_xy, grady_phi_xy] = internal::tabulated_xy(mesh, j, constants::quadrature_degree);
+            auto [nodes2x, nodes2y] = nodes2xy_j;
 
-                // Weights, space.
-                Vector<Real> weights2_j = weights2 * dxy_j;
+            // Local coefficients and solution.
+            Vector<Real> u_j = uh(dofs_j);
 
-                // Local coefficients and solution.
-                Vector<Real> u_j = uh(dofs_j);
-
-                Matrix<Real> uh_j{phi_t.rows(), phi_xy.rows()};
-
-                for(Natural kxy = 0; kxy < phi_xy.rows(); ++kxy) {
-                    Real uh_xyt = 0.0;
-
-                    for(Natural jt = 0; jt < dofs_t; ++jt)
-                        for(Natural jxy = 0; jxy < dofs_xy; ++jxy)
-                            uh_xyt += phi_t(0, jt) * phi_xy(kxy, jxy) * u_j(jt * dofs_xy + jxy);
-
-                    uh_j(0, kxy, uh_xyt);
-                }
+            Matrix<Real> uh_j = internal::evaluated(phi_t, phi_xy, u_j);
 
-                // CURRENT ERROR.
+            // CURRENT ERROR.
 
-                for(Natural kxy = 0; kxy < phi_xy.rows(); ++kxy) { // Brute-force integral.
-                    Real x = nodes2x[kxy];
-                    Real y = nodes2y[kxy];
-                    Real t = interval[1];
+            for(Natural kxy = 0; kxy < phi_xy.rows(); ++kxy) { // Brute-force integral.
+                Real x = nodes2x[kxy];
+                Real y = nodes2y[kxy];
+                Real t = interval[1];
 
-                    // L2(T) error.
+                // L2(T) error.
 
-                    this->l2Ts[i] += weights2_j(kxy) * (u(x, y, t) - uh_j(0, kxy)) * (u(x, y, t) - uh_j(0, kxy));
-                }
+                this->l2Ts[i] += weights2_j(kxy) * (u(x, y, t) - uh_j(0, kxy)) * (u(x, y, t) - uh_j(0, kxy));
             }
 
             // Error update.
@@ -330,8 +247,8 @@ namespace ivo {
         #endif
 
         // Interval.
-        auto [t0, t1] = mesh.element(0).interval();
-        t1 = mesh.element(mesh.space() * mesh.time() - 1).interval()[1];
+        auto [t0, t1] = mesh.interval(0);
+        t1 = mesh.interval(mesh.space() * mesh.time() - 1)[1];
 
         // Steps.
         Natural steps = (constants::quadrature + 1) * (mesh.time() + 1);
@@ -22,11 +22,6 @@ namespace ivo {
      */
     Vector<Real> forcing(const Mesh21 &mesh, const Equation &equation, const Data &data) {
 
-        // Quadrature.
-        auto [nodes1t, weights1t] = quadrature1t(constants::quadrature);
-        auto [nodes1x, weights1x] = quadrature1x(constants::quadrature);
-        auto [nodes2x, nodes2y, weights2] = quadrature2xy(constants::quadrature);
-
         // Forcing vector.
         Vector<Real> V{mesh.dofs()}; // Volume integrals.
         Vector<Real> I{mesh.dofs()}; // Face integrals.
@@ -39,11 +34,14 @@ namespace ivo {
         // Loop over elements.
         for(Natural j = 0; j < mesh.space() * mesh.time(); ++j) {
 
+            // Element's temporaries, thread's arena.
+            internal::Scope scope;
+
             // Element.
-            Element21 element = mesh.element(j);
+            const Element21 &element = mesh.element(j);
 
             // Neighbours.
-            Neighbour21 neighbourhood = mesh.neighbour(j);
+            const Neighbour21 &neighbourhood = mesh.neighbour(j);
 
             std::vector<std::array<Integer, 2>> facing = neighbourhood.facing();
             Natural neighbours = facing.size();
@@ -54,12 +52,19 @@ namespace ivo {
             Natural dofs_t = element.q() + 1;
             Natural dofs_xyt = dofs_t * dofs_xy;
 
+            // Quadrature degrees, volume and face terms.
+            Natural degree_xy = element.p() + data.degree();
+            Natural degree_t = element.q() + data.degree();
+            Natural e_degree_xy = element.p() + data.degree() + equation.degree();
+            Natural e_degree_t = element.q() + data.degree() + equation.degree();
+
             // VOLUME INTEGRALS - PRECOMPUTING.
 
             // Subvector.
             Vector<Real> V_xyt{dofs_xy * dofs_t};
 
             // Nodes and basis, time.
+            const auto &[nodes1t, weights1t] = quadrature1t(internal::order(degree_t));
             auto [nodes1t_j, dt_j] = internal::reference_to_element(mesh, j, nodes1t);
             auto [phi_t, gradt_phi_t] = basis_t(mesh, j, nodes1t_j);
 
@@ -67,44 +72,51 @@ namespace ivo {
 
             // VOLUME INTEGRALS - COMPUTING.
 
-            for(Natural k = 0; k < neighbours; ++k) { // Sub-triangulation.
-
-                // Nodes and basis, space.
-                auto [nodes2xy_j, dxy_j] = internal::reference_to_element(mesh, j, k, {nodes2x, nodes2y});
-                auto [phi_xy, gradx_phi_xy, grady_phi_xy] = basis_xy(mesh, j, nodes2xy_j);
-                auto [nodes2x_j, nodes2y_j] = nodes2xy_j;
+            // Nodes and weights, space, polygon-native.
+            auto [nodes2xy_j, weights2_j] = internal::polygon_quadrature(mesh, j, degree_xy);
 
-                Vector<Real> weights2_j = weights2 * dxy_j;
+            // Basis, space.
+            auto [phi_xy, gradx_phi_xy, grady_phi_xy] = internal::tabulated_xy(mesh, j, degree_xy);
+            auto [nodes2x_j, nodes2y_j] = nodes2xy_j;
 
-                // CURRENT.
+            // CURRENT.
 
-                for(Natural ht = 0; ht < dofs_t; ++ht)
-                    for(Natural hxy = 0; hxy < dofs_xy; ++hxy) {
-                        Real c_V_xyt = 0.0L;
+            for(Natural ht = 0; ht < dofs_t; ++ht)
+                for(Natural hxy = 0; hxy < dofs_xy; ++hxy) {
+                    Real c_V_xyt = 0.0L;
 
-                        for(Natural kt = 0; kt < phi_t.rows(); ++kt)
-                            for(Natural kxy = 0; kxy < phi_xy.rows(); ++kxy) { // Brute-force integral.
-                                Real x = nodes2x_j(kxy);
-                                Real y = nodes2y_j(kxy);
-                                Real t = nodes1t_j(kt);
+                    for(Natural kt = 0; kt < phi_t.rows(); ++kt)
+                        for(Natural kxy = 0; kxy < phi_xy.rows(); ++kxy) { // Brute-force integral.
+                            Real x = nodes2x_j(kxy);
+                            Real y = nodes2y_j(kxy);
+                            Real t = nodes1t_j(kt);
 
-                                // Data.
-                                Real source = data.source(x, y, t);
+                            // Data.
+                            Real source = data.source(x, y, t);
 
-                                // Source.
+                            // Source.
 
-                                c_V_xyt += weights2_j(kxy) * weights1t_j(kt) * phi_t(kt, ht) * phi_xy(kxy, hxy) * source;
-                            }
+                            c_V_xyt += weights2_j(kxy) * weights1t_j(kt) * phi_t(kt, ht) * phi_xy(kxy, hxy) * source;
+                        }
 
-                        V_xyt(ht * dofs_xy + hxy, V_xyt(ht * dofs_xy + hxy) + c_V_xyt);
-                    }
-            }
+                    V_xyt(ht * dofs_xy + hxy, V_xyt(ht * dofs_xy + hxy) + c_V_xyt);
+                }
 
             // VOLUME INTEGRALS - BUILDING.
 
             V(dofs_j, V(dofs_j) + V_xyt);
 
             // FACE INTEGRALS - PRECOMPUTING.
+
+            // Nodes and basis, time.
+            const auto &[e_nodes1t, e_weights1t] = quadrature1t(internal::order(e_degree_t));
+            auto [e_nodes1t_j, e_dt_j] = internal::reference_to_element(mesh, j, e_nodes1t);
+            auto [e_phi_t, e_gradt_phi_t] = basis_t(mesh, j, e_nodes1t_j);
+
+            Vector<Real> e_weights1t_j = e_weights1t * e_dt_j;
+
+            // Nodes, space.
+            const auto &[nodes1x, weights1x] = quadrature1x(internal::order(e_degree_xy));
             
             for(Natural k = 0; k < neighbours; ++k) {
 
@@ -114,7 +126,7 @@ namespace ivo {
 
                 // Nodes and basis, space.
                 auto [e_nodes2xy_j, normal, e_dxy_j] = internal::reference_to_element(mesh, j, k, nodes1x);
-                auto [e_phi_xy, e_gradx_phi_xy, e_grady_phi_xy] = basis_xy(mesh, j, e_nodes2xy_j);
+                auto [e_phi_xy, e_gradx_phi_xy, e_grady_phi_xy] = internal::tabulated_xy(mesh, j, j, k, internal::order(e_degree_xy));
                 auto [e_nodes2x_j, e_nodes2y_j] = e_nodes2xy_j;
 
                 // Normal gradient.
@@ -138,11 +150,11 @@ namespace ivo {
                         Real c_d_xyt = 0.0L;
                         Real c_n_xyt = 0.0L;
 
-                        for(Natural kt = 0; kt < phi_t.rows(); ++kt)
+                        for(Natural kt = 0; kt < e_phi_t.rows(); ++kt)
                             for(Natural kxy = 0; kxy < e_phi_xy.rows(); ++kxy) { // Brute-force integral.
                                 Real x = e_nodes2x_j(kxy);
                                 Real y = e_nodes2y_j(kxy);
-                                Real t = nodes1t_j(kt);
+                                Real t = e_nodes1t_j(kt);
 
                                 // Equation coefficients.
                                 auto [convection_x, convection_y] = equation.convection(x, y, t);
@@ -159,14 +171,14 @@ namespace ivo {
 
                                 // Dirichlet.
 
-                                c_de_xyt += negative * e_weights2_j(kxy) / e_dxy_j * weights1t_j(kt) * phi_t(kt, ht) * e_phi_xy(kxy, hxy) * dirichlet * diffusion;
-                                c_de_xyt += negative * e_weights2_j(kxy) * weights1t_j(kt) * phi_t(kt, ht) * e_gradn_phi_xy(kxy, hxy) * dirichlet * diffusion;
+                                c_de_xyt += negative * e_weights2_j(kxy) / e_dxy_j * e_weights1t_j(kt) * e_phi_t(kt, ht) * e_phi_xy(kxy, hxy) * dirichlet * diffusion;
+                                c_de_xyt += negative * e_weights2_j(kxy) * e_weights1t_j(kt) * e_phi_t(kt, ht) * e_gradn_phi_xy(kxy, hxy) * dirichlet * diffusion;
 
-                                c_d_xyt -= negative * e_weights2_j(kxy) * weights1t_j(kt) * phi_t(kt, ht) * e_phi_xy(kxy, hxy) * dirichlet * convection_n;
+                                c_d_xyt -= negative * e_weights2_j(kxy) * e_weights1t_j(kt) * e_phi_t(kt, ht) * e_phi_xy(kxy, hxy) * dirichlet * convection_n;
 
                                 // Neumann.
 
-                                c_n_xyt += positive * e_weights2_j(kxy) * weights1t_j(kt) * phi_t(kt, ht) * e_phi_xy(kxy, hxy) * neumann;
+                                c_n_xyt += positive * e_weights2_j(kxy) * e_weights1t_j(kt) * e_phi_t(kt, ht) * e_phi_xy(kxy, hxy) * neumann;
                             }
                         
                         I_de_xyt(ht * dofs_xy + hxy, I_de_xyt(ht * dofs_xy + hxy) + c_de_xyt);
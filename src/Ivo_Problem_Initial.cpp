@@ -18,8 +18,9 @@ namespace ivo {
      * @brief Default constructor.
      * 
      * @param condition Initial condition.
+     * @param degree Condition's extra quadrature degree.
      */
-    Initial::Initial(const std::function<Real (Real, Real)> &condition): _condition{condition} {}
+    Initial::Initial(const std::function<Real (Real, Real)> &condition, const Natural &degree): _condition{condition}, _degree{degree} {}
 
     // Access.
 
@@ -0,0 +1,282 @@
+/**
+ * @file Problem_Multigrid.cpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Problem/Multigrid.hpp implementation.
+ * @date 2024-10-21
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include <Ivo.hpp>
+
+namespace ivo {
+
+    /**
+     * @brief Constructs a new Multigrid object for a time slab.
+     * 
+     * @param mesh Mesh.
+     * @param slab Time slab's index.
+     * @param A Time slab's stiffness matrix.
+     */
+    Multigrid::Multigrid(const Mesh21 &mesh, const Natural &slab, Sparse<Real> &A) {
+        #ifndef NDEBUG // Integrity check.
+        assert(slab < mesh.time());
+        #endif
+
+        // Degrees.
+        std::vector<Natural> p, q;
+
+        for(Natural k = 0; k < mesh.space(); ++k) {
+            const Element21 &element = mesh.element(slab * mesh.space() + k);
+
+            p.emplace_back(element.p());
+            q.emplace_back(element.q());
+        }
+
+        this->_build(A, p, q, 1);
+    }
+
+    /**
+     * @brief Constructs a new Multigrid object from blocks' degrees.
+     * Blocks' dofs are ordered by component, time mode and space mode.
+     * 
+     * @param A Matrix.
+     * @param p Blocks' space degrees.
+     * @param q Blocks' time degrees.
+     * @param components Blocks' components, not coarsened.
+     */
+    Multigrid::Multigrid(Sparse<Real> &A, const std::vector<Natural> &p, const std::vector<Natural> &q, const Natural &components) {
+        this->_build(A, p, q, components);
+    }
+
+    /**
+     * @brief Builds the levels.
+     * 
+     * @param A Matrix.
+     * @param p Blocks' space degrees.
+     * @param q Blocks' time degrees.
+     * @param components Blocks' components.
+     */
+    void Multigrid::_build(Sparse<Real> &A, std::vector<Natural> p, std::vector<Natural> q, const Natural &components) {
+        #ifndef NDEBUG // Integrity check.
+        assert(A.rows() == A.columns());
+        assert(p.size() == q.size());
+        assert(components > 0);
+        #endif
+
+        // Finest level.
+        auto [inner, outer, entries] = A.csr();
+
+        this->_inner.emplace_back(inner);
+        this->_outer.emplace_back(outer);
+        this->_entries.emplace_back(entries);
+        this->_injections.emplace_back();
+
+        for(Natural level = 0; ; ++level) {
+
+            // Blocks.
+            std::vector<Natural> blocks{0};
+
+            for(Natural k = 0; k < p.size(); ++k)
+                blocks.emplace_back(blocks.back() + components * (p[k] + 1) * (p[k] + 2) / 2 * (q[k] + 1));
+
+            #ifndef NDEBUG // Integrity check.
+            assert(blocks.back() + 1 == this->_inner[level].size());
+            #endif
+
+            // Block smoother, diagonal blocks.
+            std::vector<Matrix<Real>> diagonals;
+
+            for(Natural k = 0; k < p.size(); ++k) {
+                Matrix<Real> D{blocks[k + 1] - blocks[k], blocks[k + 1] - blocks[k]};
+
+                for(Natural j = blocks[k]; j < blocks[k + 1]; ++j)
+                    for(Natural h = this->_inner[level][j]; h < this->_inner[level][j + 1]; ++h)
+                        if((this->_outer[level][h] >= blocks[k]) && (this->_outer[level][h] < blocks[k + 1]))
+                            D(j - blocks[k], this->_outer[level][h] - blocks[k], this->_entries[level][h]);
+
+                diagonals.emplace_back(D);
+            }
+
+            this->_blocks.emplace_back(blocks);
+            this->_factors.emplace_back(factorize<LU>(diagonals));
+
+            // Coarsest level.
+            if(std::all_of(p.begin(), p.end(), [](const Natural &p_k){ return p_k == 0; }) && std::all_of(q.begin(), q.end(), [](const Natural &q_k){ return q_k == 0; }))
+                break;
+
+            // Injection, retained modes.
+            std::vector<Natural> injection;
+
+            for(Natural k = 0; k < p.size(); ++k) {
+                Natural coarse_p = (p[k] > 0) ? p[k] - 1 : 0;
+                Natural coarse_q = (q[k] > 0) ? q[k] - 1 : 0;
+
+                Natural dofs_xy = (p[k] + 1) * (p[k] + 2) / 2;
+                Natural dofs_t = q[k] + 1;
+
+                // Spatial modes are ordered by (kx, ky), kx + ky <= p.
+                for(Natural c = 0; c < components; ++c)
+                    for(Natural jt = 0; jt < coarse_q + 1; ++jt)
+                        for(Natural kx = 0; kx < coarse_p + 1; ++kx)
+                            for(Natural ky = 0; ky < coarse_p + 1 - kx; ++ky)
+                                injection.emplace_back(blocks[k] + (c * dofs_t + jt) * dofs_xy + kx * (p[k] + 1) - kx * (kx - 1) / 2 + ky);
+
+                p[k] = coarse_p;
+                q[k] = coarse_q;
+            }
+
+            // Fine to coarse dofs.
+            std::vector<Integer> restriction(blocks.back(), -1);
+
+            for(Natural j = 0; j < injection.size(); ++j)
+                restriction[injection[j]] = static_cast<Integer>(j);
+
+            // Galerkin coarse operator, RAP.
+            std::vector<Natural> coarse_inner{0};
+            std::vector<Natural> coarse_outer;
+            std::vector<Real> coarse_entries;
+
+            for(const auto &j: injection) {
+                for(Natural h = this->_inner[level][j]; h < this->_inner[level][j + 1]; ++h)
+                    if(restriction[this->_outer[level][h]] >= 0) {
+                        coarse_outer.emplace_back(static_cast<Natural>(restriction[this->_outer[level][h]]));
+                        coarse_entries.emplace_back(this->_entries[level][h]);
+                    }
+
+                coarse_inner.emplace_back(coarse_outer.size());
+            }
+
+            this->_inner.emplace_back(coarse_inner);
+            this->_outer.emplace_back(coarse_outer);
+            this->_entries.emplace_back(coarse_entries);
+            this->_injections.emplace_back(injection);
+        }
+
+        // Coarsest level's direct solver.
+        const Natural coarsest = this->levels() - 1;
+        const Natural size = this->_blocks[coarsest].back();
+
+        if(size <= constants::multigrid_coarse) {
+            Matrix<Real> C{size, size};
+
+            for(Natural j = 0; j < size; ++j)
+                for(Natural h = this->_inner[coarsest][j]; h < this->_inner[coarsest][j + 1]; ++h)
+                    C(j, this->_outer[coarsest][h], this->_entries[coarsest][h]);
+
+            this->_coarse.emplace_back(C);
+        }
+    }
+
+    /**
+     * @brief Preconditioner application, single V-cycle.
+     * 
+     * @param b Vector.
+     * @return Vector<Real> 
+     */
+    Vector<Real> Multigrid::operator ()(const Vector<Real> &b) const {
+        #ifndef NDEBUG // Integrity check.
+        assert(b.size() == this->_blocks[0].back());
+        #endif
+
+        return this->_cycle(0, b);
+    }
+
+    /**
+     * @brief Block Gauss-Seidel sweep.
+     * 
+     * @param level Level.
+     * @param b Right-hand side.
+     * @param x Solution, updated.
+     * @param forward Sweep direction.
+     */
+    void Multigrid::_smooth(const Natural &level, const Vector<Real> &b, Vector<Real> &x, const bool &forward) const {
+
+        // Level.
+        const std::vector<Natural> &blocks = this->_blocks[level];
+        const std::vector<Natural> &inner = this->_inner[level];
+        const std::vector<Natural> &outer = this->_outer[level];
+        const std::vector<Real> &entries = this->_entries[level];
+
+        const Natural blocks_number = blocks.size() - 1;
+
+        for(Natural h = 0; h < blocks_number; ++h) {
+            const Natural k = forward ? h : blocks_number - 1 - h;
+
+            // Block residual.
+            Vector<Real> residual{blocks[k + 1] - blocks[k]};
+
+            for(Natural j = blocks[k]; j < blocks[k + 1]; ++j) {
+                Real residual_j = b(j);
+
+                for(Natural l = inner[j]; l < inner[j + 1]; ++l)
+                    residual_j -= entries[l] * x(outer[l]);
+
+                residual(j - blocks[k], residual_j);
+            }
+
+            // Block update.
+            Vector<Real> correction = this->_factors[level][k].solve(residual);
+
+            for(Natural j = blocks[k]; j < blocks[k + 1]; ++j)
+                x[j] += correction(j - blocks[k]);
+        }
+    }
+
+    /**
+     * @brief V-cycle.
+     * 
+     * @param level Level.
+     * @param b Right-hand side.
+     * @return Vector<Real> 
+     */
+    Vector<Real> Multigrid::_cycle(const Natural &level, const Vector<Real> &b) const {
+
+        // Solution.
+        Vector<Real> x{b.size()};
+
+        // Coarsest level.
+        if(level == this->levels() - 1) {
+            if(!this->_coarse.empty())
+                return this->_coarse[0].solve(b);
+
+            for(Natural j = 0; j < constants::multigrid_smoothing; ++j) {
+                this->_smooth(level, b, x, true);
+                this->_smooth(level, b, x, false);
+            }
+
+            return x;
+        }
+
+        // Pre-smoothing.
+        for(Natural j = 0; j < constants::multigrid_smoothing; ++j)
+            this->_smooth(level, b, x, true);
+
+        // Restricted residual.
+        const std::vector<Natural> &injection = this->_injections[level + 1];
+        Vector<Real> residual{injection.size()};
+
+        for(Natural j = 0; j < injection.size(); ++j) {
+            Real residual_j = b(injection[j]);
+
+            for(Natural h = this->_inner[level][injection[j]]; h < this->_inner[level][injection[j] + 1]; ++h)
+                residual_j -= this->_entries[level][h] * x(this->_outer[level][h]);
+
+            residual(j, residual_j);
+        }
+
+        // Coarse correction.
+        Vector<Real> correction = this->_cycle(level + 1, residual);
+
+        for(Natural j = 0; j < injection.size(); ++j)
+            x[injection[j]] += correction(j);
+
+        // Post-smoothing.
+        for(Natural j = 0; j < constants::multigrid_smoothing; ++j)
+            this->_smooth(level, b, x, false);
+
+        return x;
+    }
+
+}
@@ -12,143 +12,478 @@
 
 namespace ivo {
 
-    /**
-     * @brief Solves Ax = b for a 2+1 problem.
-     * 
-     * @param mesh Mesh.
-     * @param A Stiffness matrix.
-     * @param b Forcing vector.
-     * @param initial Initial condition.
-     * @return Vector<Real> 
-     */
-    Vector<Real> solve(const Mesh21 &mesh, const Sparse<Real> &A, const Vector<Real> &b, const Initial &initial) {
-        #ifndef NDEBUG // Integrity check.
-        assert(A.rows() == b.size());
-        #endif
+    namespace internal {
 
-        // Quadrature.
-        auto [nodes1x, weights1x] = quadrature1x(constants::quadrature);
-        auto [nodes2x, nodes2y, weights2] = quadrature2xy(constants::quadrature);
+        /**
+         * @brief Initial condition's time face integrals, first time slab.
+         * 
+         * @param mesh Mesh.
+         * @param initial Initial condition.
+         * @return Vector<Real> 
+         */
+        Vector<Real> initial_jump(const Mesh21 &mesh, const Initial &initial) {
 
-        // Solution.
-        Vector<Real> x{A.columns()};
+            // Time face integrals.
+            Vector<Real> E{mesh.dofs()};
 
-        // Time face integrals.
-        Vector<Real> E{b.size()}; // Face integrals, time.
+            for(Natural k = 0; k < mesh.space(); ++k) {
 
-        #ifndef NVERBOSE
-        std::cout << "[Ivo] Solver" << std::endl;
-        std::cout << "\t[Solver] Solving the problem's linear system" << std::endl;
-        #endif
+                // Element.
+                const Element21 &element = mesh.element(k);
 
-        for(Natural j = 0; j < mesh.time(); ++j) {
+                // Dofs.
+                std::vector<Natural> dofs_k = mesh.dofs(k);
+                Natural dofs_xy = (element.p() + 1) * (element.p() + 2) / 2;
+                Natural dofs_t = element.q() + 1;
 
-            // Dofs.
-            std::vector<Natural> dofs_j = mesh.dofs_t(j);
+                // Subvector.
+                Vector<Real> E_xyt{dofs_t * dofs_xy};
+
+                // Reference time trace at -1.
+                const Vector<Real> &f_phi_t = internal::time_traces(element.q())[0];
+
+                // Nodes and weights, space, polygon-native.
+                auto [nodes2xy_k, weights2_k] = internal::polygon_quadrature(mesh, k, element.p() + initial.degree());
+
+                // Basis.
+                auto [phi_xy, gradx_phi_xy, grady_phi_xy] = internal::tabulated_xy(mesh, k, element.p() + initial.degree());
+                auto [nodes2x_k, nodes2y_k] = nodes2xy_k;
+
+                // CURRENT vs. INITIAL CONDITION.
+
+                for(Natural jt = 0; jt < dofs_t; ++jt)
+                    for(Natural jxy = 0; jxy < dofs_xy; ++jxy) {
+                        Real cc_xyt = 0.0L;
+
+                        for(Natural kxy = 0; kxy < phi_xy.rows(); ++kxy) // Brute-force integral, (*, *).
+                            cc_xyt += weights2_k(kxy) * f_phi_t(jt) * phi_xy(kxy, jxy) * initial(nodes2x_k(kxy), nodes2y_k(kxy));
+
+                        E_xyt(jt * dofs_xy + jxy, E_xyt(jt * dofs_xy + jxy) + cc_xyt);
+                    }
+
+                E(dofs_k, E(dofs_k) + E_xyt);
+            }
+
+            return E;
+        }
+
+        /**
+         * @brief Solves a time slab's system by diagonalizing its time modes.
+         * With time-independent coefficients and a uniform time degree the slab's matrix reads
+         * A = G x M + dt I x K, G being the reference time matrix. Then G = W B W^-1 decouples
+         * the system into q + 1 spatial systems, complex pairs coupling two of them, solved in parallel.
+         * 
+         * @param mesh Mesh.
+         * @param slab Time slab's index.
+         * @param A Time slab's matrix.
+         * @param b Time slab's right-hand side.
+         * @param tolerance Spatial systems' relative tolerance.
+         * @return std::optional<Vector<Real>> Nothing if A lacks the Kronecker structure.
+         */
+        std::optional<Vector<Real>> diagonalized(const Mesh21 &mesh, const Natural &slab, Sparse<Real> &A, const Vector<Real> &b, const Real &tolerance) {
+            #ifndef NDEBUG // Integrity check.
+            assert(slab < mesh.time());
+            assert(A.rows() == b.size());
+            #endif
+
+            // Time degree, uniform over the slab.
+            const Natural q = mesh.element(slab * mesh.space()).q();
+
+            if(q == 0)
+                return std::nullopt;
+
+            for(Natural k = 1; k < mesh.space(); ++k)
+                if(mesh.element(slab * mesh.space() + k).q() != q)
+                    return std::nullopt;
+
+            // Time interval.
+            const auto [t_a, t_b] = mesh.interval(slab * mesh.space());
+            const Real dt = (t_b - t_a) / 2.0L;
+
+            // Reference time matrix, (*, *') and time jump, orthonormal basis.
+            const auto &[M_t, D_t, J_t] = internal::time_matrices(q);
+            const Matrix<Real> G = D_t + J_t;
+
+            // Dofs, time and space modes.
+            std::vector<Natural> mode_t, mode_s;
+            std::vector<Natural> p, offsets_s{0};
 
-            // Initial condition.
             for(Natural k = 0; k < mesh.space(); ++k) {
+                p.emplace_back(mesh.element(slab * mesh.space() + k).p());
 
-                // Element.
-                Element21 element = mesh.element(j * mesh.space() + k);
+                Natural dofs_xy = (p[k] + 1) * (p[k] + 2) / 2;
 
-                // Time interval.
-                std::array<Real, 2> interval = element.interval();
+                for(Natural jt = 0; jt < q + 1; ++jt)
+                    for(Natural jxy = 0; jxy < dofs_xy; ++jxy) {
+                        mode_t.emplace_back(jt);
+                        mode_s.emplace_back(offsets_s[k] + jxy);
+                    }
 
-                // Neighbours.
-                Neighbour21 neighbourhood = mesh.neighbour(j * mesh.space() + k);
+                offsets_s.emplace_back(offsets_s[k] + dofs_xy);
+            }
 
-                std::vector<std::array<Integer, 2>> facing = neighbourhood.facing();
-                Natural neighbours = facing.size();
+            const Natural n = offsets_s.back();
 
-                // Dofs.
-                std::vector<Natural> dofs_k = mesh.dofs(j * mesh.space() + k);
-                Natural dofs_xy = (element.p() + 1) * (element.p() + 2) / 2;
-                Natural dofs_t = element.q() + 1;
+            // Modes to dofs.
+            std::vector<Natural> dofs(mode_t.size());
 
-                // TIME FACE INTEGRALS - PRECOMPUTING.
+            for(Natural j = 0; j < mode_t.size(); ++j)
+                dofs[mode_t[j] * n + mode_s[j]] = j;
 
-                // Subvectors.
-                Vector<Real> E_xyt{dofs_t * dofs_xy};
+            #ifndef NDEBUG // Integrity check.
+            assert(mode_t.size() == A.rows());
+            #endif
+
+            // Spatial matrices, M and K.
+            auto [inner, outer, entries] = A.csr();
+            std::map<Natural, std::array<Real, 2>> MK;
+
+            Real scale = 0.0L;
 
-                // Face time basis.
-                auto [f_phi_t, f_gradt_phi_t] = basis_t(mesh, j * mesh.space() + k, Vector<Real>{1, interval[0]}); // [?]
+            for(Natural j = 0; j < A.rows(); ++j)
+                for(Natural h = inner[j]; h < inner[j + 1]; ++h) {
+                    scale = std::max(scale, std::abs(entries[h]));
 
-                // TIME FACE INTEGRALS - COMPUTING.
+                    if(mode_t[j] != 0)
+                        continue;
 
-                for(Natural h = 0; h < neighbours; ++h) { // Sub-triangulation.
+                    if(mode_t[outer[h]] == 1)
+                        MK[mode_s[j] * n + mode_s[outer[h]]][0] = entries[h] / G(0, 1);
 
-                    // Nodes and basis.
-                    auto [nodes2xy_k, dxy_k] = internal::reference_to_element(mesh, j * mesh.space() + k, h, {nodes2x, nodes2y});
-                    auto [phi_xy, gradx_phi_xy, grady_phi_xy] = basis_xy(mesh, j * mesh.space() + k, nodes2xy_k);
-                    auto [nodes2x_k, nodes2y_k] = nodes2xy_k;
+                    if(mode_t[outer[h]] == 0)
+                        MK[mode_s[j] * n + mode_s[outer[h]]][1] = entries[h];
+                }
+
+            for(auto &[index, mk]: MK)
+                mk[1] = (mk[1] - G(0, 0) * mk[0]) / dt;
 
-                    // Weights, space.
-                    Vector<Real> weights2_k = weights2 * dxy_k;
+            // Kronecker structure check, both ways.
+            for(Natural j = 0; j < A.rows(); ++j)
+                for(Natural h = inner[j]; h < inner[j + 1]; ++h) {
+                    auto mk = MK.find(mode_s[j] * n + mode_s[outer[h]]);
 
-                    // Condition.
-                    Vector<Real> condition{phi_xy.rows()};
+                    if(mk == MK.end())
+                        return std::nullopt;
 
-                    if(j == 0) { // Initial condition.
+                    Real predicted = G(mode_t[j], mode_t[outer[h]]) * mk->second[0] + ((mode_t[j] == mode_t[outer[h]]) ? dt * mk->second[1] : 0.0L);
 
-                        for(Natural kxy = 0; kxy < phi_xy.rows(); ++kxy)
-                            condition(kxy, initial(nodes2x_k(kxy), nodes2y_k(kxy)));
+                    if(std::abs(entries[h] - predicted) > constants::kronecker_zero * scale)
+                        return std::nullopt;
+                }
 
-                    } else { // Past level.
+            // Missing entries, CSR rows are sorted.
+            for(Natural jt = 0; jt < q + 1; ++jt)
+                for(Natural ht = 0; ht < q + 1; ++ht)
+                    for(const auto &[index, mk]: MK) {
+                        Real predicted = G(jt, ht) * mk[0] + ((jt == ht) ? dt * mk[1] : 0.0L);
 
-                        // Neighbour element.
-                        Element21 n_element = mesh.element((j - 1) * mesh.space() + k);
+                        if(std::abs(predicted) <= constants::kronecker_zero * scale)
+                            continue;
 
-                        // Time interval.
-                        std::array<Real, 2> n_interval = n_element.interval();
+                        const Natural j = dofs[jt * n + index / n], k = dofs[ht * n + index % n];
+
+                        if(!std::binary_search(outer.begin() + inner[j], outer.begin() + inner[j + 1], k))
+                            return std::nullopt;
+                    }
 
-                        // Neighbour basis.
-                        auto [n_phi_xy, n_gradx_phi_xy, n_grady_phi_xy] = basis_xy(mesh, (j - 1) * mesh.space() + k, nodes2xy_k);
-                        auto [n_f_phi_t, n_f_gradt_phi_t] = basis_t(mesh, (j - 1) * mesh.space() + k, Vector<Real>{1, n_interval[1]}); // [?]
+            // Time diagonalization.
+            auto [W, B] = diagonalize(G);
 
-                        // Dofs.
-                        std::vector<Natural> n_dofs_k = mesh.dofs((j - 1) * mesh.space() + k);
-                        Natural n_dofs_xy = (n_element.p() + 1) * (n_element.p() + 2) / 2;
-                        Natural n_dofs_t = n_element.q() + 1;
+            // Transformed right-hand side, W^-1 applied to every spatial mode at once.
+            Matrix<Real> b_ts{q + 1, n};
 
-                        // Solution.
-                        Vector<Real> uh = x(n_dofs_k);
+            for(Natural j = 0; j < b.size(); ++j)
+                b_ts(mode_t[j], mode_s[j], b(j));
 
-                        for(Natural kxy = 0; kxy < phi_xy.rows(); ++kxy) {
-                            Real uh_xyt = 0.0L;
+            const Matrix<Real> c_ts = LU<Real>{W}.solve(b_ts);
+            std::vector<Vector<Real>> c(q + 1, Vector<Real>{n});
 
-                            for(Natural jt = 0; jt < n_dofs_t; ++jt)
-                                for(Natural jxy = 0; jxy < n_dofs_xy; ++jxy)
-                                    uh_xyt += n_f_phi_t(0, jt) * n_phi_xy(kxy, jxy) * uh(jt * n_dofs_xy + jxy);
+            for(Natural kt = 0; kt < q + 1; ++kt)
+                for(Natural j = 0; j < n; ++j)
+                    c[kt][j] = c_ts(kt, j);
 
-                            condition(kxy, uh_xyt);
-                        }
+            // Diagonal blocks.
+            std::vector<Natural> starts;
+
+            for(Natural kt = 0; kt < q + 1; kt += ((kt < q) && (std::abs(B(kt + 1, kt)) > constants::zero)) ? 2 : 1)
+                starts.emplace_back(kt);
+
+            // Pairs' dofs, [real, imaginary] per element.
+            std::vector<Natural> pairs(2 * n);
+
+            for(Natural k = 0; k < mesh.space(); ++k)
+                for(Natural jxy = 0; jxy < offsets_s[k + 1] - offsets_s[k]; ++jxy) {
+                    pairs[offsets_s[k] + jxy] = 2 * offsets_s[k] + jxy;
+                    pairs[n + offsets_s[k] + jxy] = 2 * offsets_s[k] + offsets_s[k + 1] - offsets_s[k] + jxy;
+                }
+
+            // Spatial systems.
+            std::vector<Vector<Real>> y(q + 1, Vector<Real>{n});
+            const std::vector<Natural> q_s(mesh.space(), 0);
+
+            // Per-mode logs, printed in order after the parallel region.
+            std::vector<std::ostringstream> logs(starts.size());
+
+            #pragma omp parallel for
+            for(Natural h = 0; h < starts.size(); ++h) {
+                const Natural kt = starts[h];
+
+                if((kt == q) || (std::abs(B(kt + 1, kt)) <= constants::zero)) { // Real eigenvalue.
+
+                    // B(kt, kt) M + dt K.
+                    Sparse<Real> S{n, n};
+
+                    for(const auto &[index, mk]: MK)
+                        S(index / n, index % n, B(kt, kt) * mk[0] + dt * mk[1]);
+
+                    Multigrid multigrid{S, p, q_s};
+                    y[kt] = internal::gmres<Real>(S, c[kt], [&multigrid](const Vector<Real> &r){ return multigrid(r); }, tolerance, logs[h]);
+
+                } else { // Complex pair.
+
+                    // [alpha M + dt K, beta M; -beta M, alpha M + dt K].
+                    Sparse<Real> S{2 * n, 2 * n};
+
+                    for(const auto &[index, mk]: MK) {
+                        const Natural j = index / n, k = index % n;
+
+                        S(pairs[j], pairs[k], B(kt, kt) * mk[0] + dt * mk[1]);
+                        S(pairs[j], pairs[n + k], B(kt, kt + 1) * mk[0]);
+                        S(pairs[n + j], pairs[k], B(kt + 1, kt) * mk[0]);
+                        S(pairs[n + j], pairs[n + k], B(kt + 1, kt + 1) * mk[0] + dt * mk[1]);
                     }
 
-                    // CURRENT vs. CONDITION.
+                    Vector<Real> c_pair{2 * n};
 
-                    for(Natural jt = 0; jt < dofs_t; ++jt)
-                        for(Natural jxy = 0; jxy < dofs_xy; ++jxy) {
-                            Real cc_xyt = 0.0L;
+                    for(Natural j = 0; j < n; ++j) {
+                        c_pair[pairs[j]] = c[kt](j);
+                        c_pair[pairs[n + j]] = c[kt + 1](j);
+                    }
 
-                            for(Natural kxy = 0; kxy < phi_xy.rows(); ++kxy) // Brute-force integral, (*, *).
-                                cc_xyt += weights2_k(kxy) * f_phi_t(0, jt) * phi_xy(kxy, jxy) * condition(kxy);
+                    Multigrid multigrid{S, p, q_s, 2};
+                    Vector<Real> y_pair = internal::gmres<Real>(S, c_pair, [&multigrid](const Vector<Real> &r){ return multigrid(r); }, tolerance, logs[h]);
 
-                            E_xyt(jt * dofs_xy + jxy, E_xyt(jt * dofs_xy + jxy) + cc_xyt);
-                        }
+                    for(Natural j = 0; j < n; ++j) {
+                        y[kt][j] = y_pair(pairs[j]);
+                        y[kt + 1][j] = y_pair(pairs[n + j]);
+                    }
                 }
+            }
 
-                // TIME FACE INTEGRALS - BUILDING.
+            #ifndef NVERBOSE
+            for(const auto &log: logs)
+                std::cout << log.str();
+            #endif
 
-                E(dofs_k, E(dofs_k) + E_xyt);
+            // Back to the slab's dofs.
+            Vector<Real> x{b.size()};
+
+            for(Natural j = 0; j < b.size(); ++j) {
+                Real x_j = 0.0L;
+
+                for(Natural kt = 0; kt < q + 1; ++kt)
+                    x_j += W(mode_t[j], kt) * y[kt](mode_s[j]);
+
+                x(j, x_j);
             }
 
+            return x;
+        }
+
+        /**
+         * @brief All-at-once solver, windows of time slabs.
+         * Each window is solved by GMRES, preconditioned by a block forward substitution
+         * whose time slab solves are multigrid V-cycles.
+         * 
+         * @param mesh Mesh.
+         * @param A Stiffness matrix.
+         * @param b Forcing vector.
+         * @param initial Initial condition.
+         * @param tolerance Windows' relative tolerance.
+         * @return Vector<Real> 
+         */
+        Vector<Real> all_at_once(const Mesh21 &mesh, const Sparse<Real> &A, const Vector<Real> &b, const Initial &initial, const Real &tolerance) {
+
+            // Solution.
+            Vector<Real> x{A.columns()};
+
+            // Coupling and initial condition.
+            Sparse<Real> C = coupling(mesh);
+            Vector<Real> E = initial_jump(mesh, initial);
+
+            for(Natural w = 0; w < mesh.time(); w += constants::window) {
+
+                // Window's slabs.
+                const Natural slabs = std::min(constants::window, mesh.time() - w);
+
+                // Dofs, global and window's.
+                std::vector<std::vector<Natural>> dofs_s, locals_s;
+                std::vector<Natural> dofs_w;
+
+                for(Natural j = 0; j < slabs; ++j) {
+                    dofs_s.emplace_back(mesh.dofs_t(w + j));
+                    locals_s.emplace_back();
+
+                    for(const auto &dof: dofs_s[j]) {
+                        locals_s[j].emplace_back(dofs_w.size());
+                        dofs_w.emplace_back(dof);
+                    }
+                }
+
+                // Window's system.
+                Sparse<Real> A_w = Sparse<Real>{A, dofs_w, dofs_w} + Sparse<Real>{C, dofs_w, dofs_w};
+                Vector<Real> b_w = b(dofs_w) + E(dofs_w);
+
+                // Past window.
+                if(w > 0) {
+                    std::vector<Natural> dofs_p = mesh.dofs_t(w - 1);
+                    Sparse<Real> C_p = Sparse<Real>{C, dofs_s[0], dofs_p};
+
+                    b_w(locals_s[0], b_w(locals_s[0]) - C_p * x(dofs_p));
+                }
+
+                // Preconditioner, slabs' multigrid and couplings.
+                std::vector<Multigrid> multigrids;
+                std::vector<Sparse<Real>> couplings;
+
+                for(Natural j = 0; j < slabs; ++j) {
+                    Sparse<Real> A_j = Sparse<Real>{A, dofs_s[j], dofs_s[j]};
+                    multigrids.emplace_back(mesh, w + j, A_j);
+
+                    if(j > 0)
+                        couplings.emplace_back(C, dofs_s[j], dofs_s[j - 1]);
+                }
+
+                // Block forward substitution.
+                auto preconditioner = [&multigrids, &couplings, &locals_s, &slabs](const Vector<Real> &r) {
+                    Vector<Real> z{r.size()};
+
+                    for(Natural j = 0; j < slabs; ++j) {
+                        Vector<Real> r_j = r(locals_s[j]);
+
+                        if(j > 0)
+                            r_j -= couplings[j - 1] * z(locals_s[j - 1]);
+
+                        z(locals_s[j], multigrids[j](r_j));
+                    }
+
+                    return z;
+                };
+
+                // Solution update.
+                x(dofs_w, internal::gmres<Real>(A_w, b_w, preconditioner, tolerance));
+
+                #ifndef NVERBOSE
+                std::cout << "\t[Solver] Progress: " << w + slabs << "/" << mesh.time() << std::endl;
+                #endif
+            }
+
+            return x;
+        }
+
+    }
+
+    /**
+     * @brief Solves Ax = b for a 2+1 problem.
+     * 
+     * @param mesh Mesh.
+     * @param A Stiffness matrix.
+     * @param b Forcing vector.
+     * @param initial Initial condition.
+     * @param strategy Time slab solution strategy.
+     * @param stopping Stopping criterion, adaptive acts as relative for the all-at-once strategy.
+     * @return Vector<Real> 
+     */
+    Vector<Real> solve(const Mesh21 &mesh, const Sparse<Real> &A, const Vector<Real> &b, const Initial &initial, const Strategy &strategy, const Stopping &stopping) {
+        #ifndef NDEBUG // Integrity check.
+        assert(A.rows() == b.size());
+        #endif
+
+        // Solution.
+        Vector<Real> x{A.columns()};
+
+        #ifndef NVERBOSE
+        std::cout << "[Ivo] Solver" << std::endl;
+        std::cout << "\t[Solver] Solving the problem's linear system" << std::endl;
+        #endif
+
+        // Relative tolerance.
+        const Real relative = (stopping == Stopping::Absolute) ? 0.0L : constants::solvers_tolerance;
+
+        // All-at-once.
+        if(strategy == Strategy::AllAtOnce) {
+            x = internal::all_at_once(mesh, A, b, initial, relative);
+
+            #ifndef NVERBOSE
+            std::cout << "\t[Solver] Exited" << std::endl;
+            #endif
+
+            return x;
+        }
+
+        // Coupling and initial condition.
+        Sparse<Real> C = coupling(mesh);
+        Vector<Real> E = internal::initial_jump(mesh, initial);
+
+        // Time jumps, a-posteriori estimate.
+        Sparse<Real> J = (stopping == Stopping::Adaptive) ? jump(mesh) : Sparse<Real>{mesh.dofs(), mesh.dofs()};
+        Real estimate = 0.0L;
+
+        // Past time slab's dofs.
+        std::vector<Natural> dofs_p;
+
+        for(Natural j = 0; j < mesh.time(); ++j) {
+
+            // Dofs.
+            std::vector<Natural> dofs_j = mesh.dofs_t(j);
+
             // Sub-matrix and sub-vector.
             Sparse<Real> A_j = Sparse<Real>{A, dofs_j, dofs_j};
             Vector<Real> b_j = b(dofs_j) + E(dofs_j);
 
+            // Past time slab, upwind.
+            if(j > 0) {
+                Sparse<Real> C_j = Sparse<Real>{C, dofs_j, dofs_p};
+                b_j -= C_j * x(dofs_p);
+            }
+
+            // Tolerance, past time slab's estimate.
+            Real tolerance = relative;
+
+            if((stopping == Stopping::Adaptive) && (estimate > constants::zero))
+                tolerance = constants::solvers_safety * estimate / norm(b_j);
+
+            // Time slab's solution.
+            std::optional<Vector<Real>> x_j = std::nullopt;
+
+            if(strategy == Strategy::Diagonalized)
+                x_j = internal::diagonalized(mesh, j, A_j, b_j, tolerance);
+
+            if(!x_j) {
+
+                // Preconditioner.
+                Multigrid multigrid{mesh, j, A_j};
+
+                x_j = internal::gmres<Real>(A_j, b_j, [&multigrid](const Vector<Real> &r){ return multigrid(r); }, tolerance);
+            }
+
             // Solution update.
-            x(dofs_j, internal::gmres(A_j, b_j));
+            x(dofs_j, x_j.value());
+
+            // Time jump's estimate, |E x_j + C x_{j - 1}|, the initial condition being the first slab's past.
+            if(stopping == Stopping::Adaptive) {
+                Sparse<Real> J_j = Sparse<Real>{J, dofs_j, dofs_j};
+                Vector<Real> jump_j = J_j * x_j.value() - E(dofs_j);
+
+                if(j > 0) {
+                    Sparse<Real> C_j = Sparse<Real>{C, dofs_j, dofs_p};
+                    jump_j += C_j * x(dofs_p);
+                }
+
+                estimate = norm(jump_j);
+            }
+
+            dofs_p = dofs_j;
 
             #ifndef NVERBOSE
             std::cout << "\t[Solver] Progress: " << j + 1 << "/" << mesh.time() << std::endl;
@@ -14,6 +14,7 @@ namespace ivo {
 
     /**
      * @brief Builds the stiffness matrix for a 2+1D equation.
+     * Constant coefficients are integrated exactly over monomial coefficients, non-constant ones by quadrature.
      * 
      * @param mesh Mesh.
      * @param equation Equation.
@@ -21,17 +22,14 @@ namespace ivo {
      */
     Sparse<Real> stiffness(const Mesh21 &mesh, const Equation &equation) {
 
-        // Quadrature.
-        auto [nodes1t, weights1t] = quadrature1t(constants::quadrature);
-        auto [nodes1x, weights1x] = quadrature1x(constants::quadrature);
-        auto [nodes2x, nodes2y, weights2] = quadrature2xy(constants::quadrature);
-
         // Stiffness submatrices.
         Sparse<Real> T{mesh.dofs(), mesh.dofs()}; // Volume integrals, time.
-        Sparse<Real> E{mesh.dofs(), mesh.dofs()}; // Face integrals, time.
         Sparse<Real> V{mesh.dofs(), mesh.dofs()}; // Volume integrals.
         Sparse<Real> I{mesh.dofs(), mesh.dofs()}; // Face integrals.
 
+        // Exact space integrals.
+        const bool exact = equation.constant();
+
         #ifndef NVERBOSE
         std::cout << "[Ivo] Stiffness" << std::endl;
         std::cout << "\t[Stiffness] Building the stiffness matrix" << std::endl;
@@ -40,98 +38,94 @@ namespace ivo {
         // Loop over elements.
         for(Natural j = 0; j < mesh.space() * mesh.time(); ++j) {
 
+            // Element's temporaries, thread's arena.
+            internal::Scope scope;
+
             // ELEMENT DATA.
 
             // Element.
-            Element21 element = mesh.element(j);
-
-            // Time interval.
-            std::array<Real, 2> interval = element.interval();
+            const Element21 &element = mesh.element(j);
 
             // Dofs.
             std::vector<Natural> dofs_j = mesh.dofs(j);
-            Natural dofs_xy = (element.p() + 1) * (element.p() + 2) / 2;
-            Natural dofs_t = element.q() + 1;
-            Natural dofs_xyt = dofs_t * dofs_xy;
 
             // Neighbours.
-            Neighbour21 neighbourhood = mesh.neighbour(j);
+            const Neighbour21 &neighbourhood = mesh.neighbour(j);
 
             std::vector<std::array<Integer, 2>> facing = neighbourhood.facing();
             Natural neighbours = facing.size();
 
+            // Quadrature degrees, polynomial and coefficient terms.
+            Natural degree_xy = 2 * element.p();
+            Natural degree_t = 2 * element.q();
+            Natural c_degree_xy = degree_xy + equation.degree();
+            Natural c_degree_t = degree_t + equation.degree();
+
             // VOLUME INTEGRALS - PRECOMPUTING.
 
-            // Submatrices.
-            Matrix<Real> V_T_xyt{dofs_xyt, dofs_xyt};
-            Matrix<Real> V_a_xyt{dofs_xyt, dofs_xyt};
-            Matrix<Real> V_b_xyt{dofs_xyt, dofs_xyt};
-            Matrix<Real> V_c_xyt{dofs_xyt, dofs_xyt};
+            // Reference time matrices, (*, *) and (*, *').
+            const auto &[M_t, D_t, J_t] = internal::time_matrices(element.q());
 
-            // Nodes and basis, time.
+            // Coefficient nodes and basis, time, the midpoint for constant coefficients.
+            const auto &[nodes1t, weights1t] = quadrature1t(exact ? 1 : internal::order(c_degree_t));
             auto [nodes1t_j, dt_j] = internal::reference_to_element(mesh, j, nodes1t);
             auto [phi_t, gradt_phi_t] = basis_t(mesh, j, nodes1t_j);
 
             // Weights, time.
             Vector<Real> weights1t_j = weights1t * dt_j;
 
-            // VOLUME INTEGRALS - COMPUTING.
+            // Coefficient nodes and weights, space, the box's centre for constant coefficients.
+            const auto [x_c, y_c, h_x, h_y] = mesh.cell(j).box();
+            auto [nodes2xy_j, weights2_j] = exact ? std::tuple{std::array{Vector<Real>{1, x_c}, Vector<Real>{1, y_c}}, Vector<Real>{1, h_x * h_y}} : internal::polygon_quadrature(mesh, j, c_degree_xy);
+            auto [nodes2x_j, nodes2y_j] = nodes2xy_j;
 
-            for(Natural k = 0; k < neighbours; ++k) { // Sub-triangulation.
+            // Space integrator, polynomial terms: exact moments over monomial coefficients or polygon-native quadrature over tabulations.
+            const Matrix<Real> moments = exact ? internal::moments_xy(mesh, j, degree_xy) : Matrix<Real>{1, 1};
+            auto [p_nodes2xy_j, p_weights2_j] = exact ? std::tuple{nodes2xy_j, weights2_j} : internal::polygon_quadrature(mesh, j, degree_xy);
 
-                // Nodes and basis, space.
-                auto [nodes2xy_j, dxy_j] = internal::reference_to_element(mesh, j, k, {nodes2x, nodes2y});
-                auto [phi_xy, gradx_phi_xy, grady_phi_xy] = basis_xy(mesh, j, nodes2xy_j);
-                auto [nodes2x_j, nodes2y_j] = nodes2xy_j;
+            auto [p_phi_xy, p_gradx_phi_xy, p_grady_phi_xy] = exact ? internal::monomials_xy(mesh, j) : internal::tabulated_xy(mesh, j, degree_xy);
+            auto [phi_xy, gradx_phi_xy, grady_phi_xy] = exact ? std::array{p_phi_xy, p_gradx_phi_xy, p_grady_phi_xy} : internal::tabulated_xy(mesh, j, c_degree_xy);
 
-                // Weights, space.
-                Vector<Real> weights2_j = weights2 * dxy_j;
+            auto volume = [&](const Matrix<Real> &L, const Matrix<Real> &R) -> Matrix<Real> {
+                return exact ? internal::exact_xy(moments, L, R) : internal::weighted(L, p_weights2_j, R);
+            };
 
-                // CURRENT vs. CURRENT.
+            // Coefficient terms, constant coefficients factor out of the space integrator, nodal ones are sum-factorized.
+            auto coefficient = [&](const Matrix<Real> &L, const Matrix<Real> &R, const Matrix<Real> &C) -> Matrix<Real> {
+                return exact ? C(0, 0) * dt_j * internal::kronecker(M_t, volume(L, R)) : internal::factorized(phi_t, phi_t, weights1t_j, L, R, weights2_j, C);
+            };
 
-                for(Natural jt = 0; jt < dofs_t; ++jt)
-                    for(Natural ht = 0; ht < dofs_t; ++ht)
-                        for(Natural jxy = 0; jxy < dofs_xy; ++jxy)
-                            for(Natural hxy = 0; hxy < dofs_xy; ++hxy) {
-                                Real V_T_cc = 0.0L;
-                                Real V_a_cc = 0.0L;
-                                Real V_b_cc = 0.0L;
-                                Real V_c_cc = 0.0L;
+            // Equation coefficients at the nodes.
+            Real diffusion = equation.diffusion();
 
-                                for(Natural kt = 0; kt < phi_t.rows(); ++kt)
-                                    for(Natural kxy = 0; kxy < phi_xy.rows(); ++kxy) { // Brute-force integral.
-                                        Real x = nodes2x_j(kxy);
-                                        Real y = nodes2y_j(kxy);
-                                        Real t = nodes1t_j(kt);
+            Matrix<Real> convection_x{phi_t.rows(), nodes2x_j.size()};
+            Matrix<Real> convection_y{phi_t.rows(), nodes2x_j.size()};
+            Matrix<Real> reaction{phi_t.rows(), nodes2x_j.size()};
 
-                                        // Equation coefficients.
-                                        auto [convection_x, convection_y] = equation.convection(x, y, t);
-                                        Real diffusion = equation.diffusion();
-                                        Real reaction = equation.reaction(x, y, t);
+            for(Natural kt = 0; kt < phi_t.rows(); ++kt)
+                for(Natural kxy = 0; kxy < nodes2x_j.size(); ++kxy) {
+                    auto [c_x, c_y] = equation.convection(nodes2x_j(kxy), nodes2y_j(kxy), nodes1t_j(kt));
 
-                                        // (*', *).
-
-                                        V_T_cc += weights2_j(kxy) * weights1t_j(kt) * gradt_phi_t(kt, ht) * phi_xy(kxy, hxy) * phi_t(kt, jt) * phi_xy(kxy, jxy);
-
-                                        // a(*, *), diffusion.
+                    convection_x(kt, kxy, c_x);
+                    convection_y(kt, kxy, c_y);
+                    reaction(kt, kxy, equation.reaction(nodes2x_j(kxy), nodes2y_j(kxy), nodes1t_j(kt)));
+                }
 
-                                        V_a_cc += weights2_j(kxy) * weights1t_j(kt) * (phi_t(kt, ht) * gradx_phi_xy(kxy, hxy) * phi_t(kt, jt) * gradx_phi_xy(kxy, jxy) + phi_t(kt, ht) * grady_phi_xy(kxy, hxy) * phi_t(kt, jt) * grady_phi_xy(kxy, jxy)) * diffusion;
+            // VOLUME INTEGRALS - COMPUTING.
 
-                                        // b(*, *), convection.
+            // CURRENT vs. CURRENT, sum-factorized.
 
-                                        V_b_cc += weights2_j(kxy) * weights1t_j(kt) * phi_t(kt, ht) * (gradx_phi_xy(kxy, hxy) * convection_x + grady_phi_xy(kxy, hxy) * convection_y) * phi_t(kt, jt) * phi_xy(kxy, jxy);
+            // (*', *).
+            Matrix<Real> V_T_xyt = internal::kronecker(D_t, volume(p_phi_xy, p_phi_xy));
 
-                                        // c(*, *), reaction.
+            // a(*, *), diffusion.
+            Matrix<Real> V_a_xyt = diffusion * dt_j * internal::kronecker(M_t, volume(p_gradx_phi_xy, p_gradx_phi_xy) + volume(p_grady_phi_xy, p_grady_phi_xy));
 
-                                        V_c_cc += weights2_j(kxy) * weights1t_j(kt) * phi_t(kt, ht) * phi_xy(kxy, hxy) * phi_t(kt, jt) * phi_xy(kxy, jxy) * reaction;
-                                    }
+            // b(*, *), convection.
+            Matrix<Real> V_b_xyt = coefficient(phi_xy, gradx_phi_xy, convection_x) + coefficient(phi_xy, grady_phi_xy, convection_y);
 
-                                V_T_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy, V_T_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy) + V_T_cc);
-                                V_a_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy, V_a_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy) + V_a_cc);
-                                V_b_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy, V_b_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy) + V_b_cc);
-                                V_c_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy, V_c_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy) + V_c_cc);
-                            }
-            }
+            // c(*, *), reaction.
+            Matrix<Real> V_c_xyt = coefficient(phi_xy, phi_xy, reaction);
 
             // VOLUME INTEGRALS - BUILDING.
 
@@ -147,340 +141,323 @@ namespace ivo {
             std::vector<Matrix<Real>> I_cn;
             std::vector<Matrix<Real>> I_nc;
             std::vector<Matrix<Real>> I_nn;
+
+            // Time mass, current.
+            const Matrix<Real> M_cc = dt_j * M_t;
             
             for(Natural k = 0; k < neighbours; ++k) {
 
-                // Nodes and basis, space.
+                // Quadrature degree, space, neighbour included.
+                Natural e_degree_xy = 2 * ((facing[k][0] != -1) ? std::max(element.p(), mesh.element(facing[k][0]).p()) : element.p()) + equation.degree();
+
+                // Quadrature degree, time, neighbour included.
+                Natural e_degree_t = 2 * ((facing[k][0] != -1) ? std::max(element.q(), mesh.element(facing[k][0]).q()) : element.q()) + equation.degree();
+
+                // Nodes and basis, time, the midpoint for constant coefficients.
+                const auto &[e_nodes1t, e_weights1t] = quadrature1t(exact ? 1 : internal::order(e_degree_t));
+                auto [e_nodes1t_j, e_dt_j] = internal::reference_to_element(mesh, j, e_nodes1t);
+                auto [e_phi_t, e_gradt_phi_t] = basis_t(mesh, j, e_nodes1t_j);
+
+                // Weights, time.
+                Vector<Real> e_weights1t_j = e_weights1t * e_dt_j;
+
+                // Nodes, space, the midpoint for constant coefficients.
+                const auto &[nodes1x, weights1x] = quadrature1x(exact ? 1 : internal::order(e_degree_xy));
                 auto [e_nodes2xy_j, normal, e_dxy_j] = internal::reference_to_element(mesh, j, k, nodes1x);
-                auto [e_phi_xy, e_gradx_phi_xy, e_grady_phi_xy] = basis_xy(mesh, j, e_nodes2xy_j);
                 auto [e_nodes2x_j, e_nodes2y_j] = e_nodes2xy_j;
 
+                // Weights, space.
+                Vector<Real> e_weights2_j = weights1x * e_dxy_j;
+
+                // Basis, space.
+                auto [e_phi_xy, e_gradx_phi_xy, e_grady_phi_xy] = exact ? internal::monomials_edge(mesh, j, j, k) : internal::tabulated_xy(mesh, j, j, k, internal::order(e_degree_xy));
+
                 // Normal gradient.
                 Matrix<Real> e_gradn_phi_xy = normal(0) * e_gradx_phi_xy + normal(1) * e_grady_phi_xy;
 
-                // Weights, space.
-                Vector<Real> e_weights2_j = weights1x * e_dxy_j;
+                // Space integrator.
+                auto edge = [&](const Matrix<Real> &L, const Matrix<Real> &R) -> Matrix<Real> {
+                    return exact ? internal::exact_edge(e_dxy_j, L, R) : internal::weighted(L, e_weights2_j, R);
+                };
+
+                // Coefficient terms, inflow.
+                auto inflow = [&](const Matrix<Real> &M, const Matrix<Real> &L_t, const Matrix<Real> &R_t, const Matrix<Real> &L, const Matrix<Real> &R, const Matrix<Real> &C) -> Matrix<Real> {
+                    return exact ? C(0, 0) * internal::kronecker(M, edge(L, R)) : internal::factorized(L_t, R_t, e_weights1t_j, L, R, e_weights2_j, C);
+                };
+
+                // Upwinding at the nodes, inflow indicator and inflow normal convection.
+                Matrix<Real> negative{e_phi_t.rows(), e_nodes2x_j.size()};
+                Matrix<Real> negative_n{e_phi_t.rows(), e_nodes2x_j.size()};
 
-                // Submatrices.
-                Matrix<Real> I_a_cc_xyt{dofs_xyt, dofs_xyt};
-                Matrix<Real> I_b_cc_xyt{dofs_xyt, dofs_xyt};
-                Matrix<Real> I_J_cc_xyt{dofs_xyt, dofs_xyt};
+                for(Natural kt = 0; kt < e_phi_t.rows(); ++kt)
+                    for(Natural kxy = 0; kxy < e_nodes2x_j.size(); ++kxy) {
+                        auto [c_x, c_y] = equation.convection(e_nodes2x_j(kxy), e_nodes2y_j(kxy), e_nodes1t_j(kt));
+                        Real convection_n = normal(0) * c_x + normal(1) * c_y;
+
+                        // Boundary check.
+                        if(convection_n < 0.0L) {
+                            negative(kt, kxy, 1.0L);
+                            negative_n(kt, kxy, convection_n);
+                        }
+                    }
 
                 if(facing[k][0] != -1) {
 
                     // Neighbour index.
                     Natural i = facing[k][0];
 
-                    // Neighbour element.
-                    Element21 n_element = mesh.element(i);
-
                     // Neighbour basis.
-                    auto [n_e_phi_xy, n_e_gradx_phi_xy, n_e_grady_phi_xy] = basis_xy(mesh, i, e_nodes2xy_j);
-                    auto [n_phi_t, n_gradt_phi_t] = basis_t(mesh, i, nodes1t_j);
+                    auto [n_e_phi_xy, n_e_gradx_phi_xy, n_e_grady_phi_xy] = exact ? internal::monomials_edge(mesh, i, j, k) : internal::tabulated_xy(mesh, i, j, k, internal::order(e_degree_xy));
+                    auto [n_phi_t, n_gradt_phi_t] = basis_t(mesh, i, e_nodes1t_j);
 
                     // Normal gradient.
                     Matrix<Real> n_e_gradn_phi_xy = normal(0) * n_e_gradx_phi_xy + normal(1) * n_e_grady_phi_xy;
 
-                    // Dofs.
-                    Natural n_dofs_xy = (n_element.p() + 1) * (n_element.p() + 2) / 2;
-                    Natural n_dofs_t = n_element.q() + 1;
-                    Natural n_dofs_xyt = n_dofs_t * n_dofs_xy;
-
-                    // Submatrices.
-                    Matrix<Real> I_a_cn_xyt{dofs_xyt, n_dofs_xyt};
-                    Matrix<Real> I_b_cn_xyt{dofs_xyt, n_dofs_xyt};
-                    Matrix<Real> I_J_cn_xyt{dofs_xyt, n_dofs_xyt};
+                    // Time masses, orthonormal Legendre basis of possibly different degrees.
+                    const Natural q = std::max(element.q(), mesh.element(i).q());
+                    const Matrix<Real> &M_q = internal::time_matrices(q)[0];
 
-                    Matrix<Real> I_a_nc_xyt{n_dofs_xyt, dofs_xyt};
-                    Matrix<Real> I_b_nc_xyt{n_dofs_xyt, dofs_xyt};
-                    Matrix<Real> I_J_nc_xyt{n_dofs_xyt, dofs_xyt};
+                    std::vector<Natural> modes_c(element.q() + 1), modes_n(mesh.element(i).q() + 1);
+                    std::iota(modes_c.begin(), modes_c.end(), 0);
+                    std::iota(modes_n.begin(), modes_n.end(), 0);
 
-                    Matrix<Real> I_a_nn_xyt{n_dofs_xyt, n_dofs_xyt};
-                    Matrix<Real> I_b_nn_xyt{n_dofs_xyt, n_dofs_xyt};
-                    Matrix<Real> I_J_nn_xyt{n_dofs_xyt, n_dofs_xyt};
+                    const Matrix<Real> M_cn = dt_j * M_q(modes_c, modes_n);
+                    const Matrix<Real> M_nc = dt_j * M_q(modes_n, modes_c);
+                    const Matrix<Real> M_nn = dt_j * M_q(modes_n, modes_n);
 
                     // FACE INTEGRALS - COMPUTING.
 
                     // CURRENT vs. CURRENT.
 
-                    for(Natural jt = 0; jt < dofs_t; ++jt)
-                        for(Natural ht = 0; ht < dofs_t; ++ht)
-                            for(Natural jxy = 0; jxy < dofs_xy; ++jxy)
-                                for(Natural hxy = 0; hxy < dofs_xy; ++hxy) {
-                                    Real a_cc_xyt = 0.0L;
-                                    Real b_cc_xyt = 0.0L;
-                                    Real J_cc_xyt = 0.0L;
-
-                                    for(Natural kt = 0; kt < phi_t.rows(); ++kt)
-                                        for(Natural kxy = 0; kxy < e_phi_xy.rows(); ++kxy) { // Brute-force integral.
-                                            Real x = e_nodes2x_j(kxy);
-                                            Real y = e_nodes2y_j(kxy);
-                                            Real t = nodes1t_j(kt);
-
-                                            // Equation coefficients.
-                                            auto [convection_x, convection_y] = equation.convection(x, y, t);
-                                            Real convection_n = normal(0) * convection_x + normal(1) * convection_y;
-                                            Real diffusion = equation.diffusion();
-
-                                            // Boundary check.
-                                            Real negative = (convection_n < 0.0L) ? 1.0L : 0.0L;
-
-                                            // a(*, *), diffusion.
-
-                                            if(i < j)
-                                                a_cc_xyt -= weights1t_j(kt) * e_weights2_j(kxy) * (0.5L * phi_t(kt, ht) * e_gradn_phi_xy(kxy, hxy) * phi_t(kt, jt) * e_phi_xy(kxy, jxy) - 0.5L * phi_t(kt, jt) * e_gradn_phi_xy(kxy, jxy) * phi_t(kt, ht) * e_phi_xy(kxy, hxy)) * diffusion;
-
-                                            // b(*, *), convection.
+                    // b(*, *), convection, and J(*, *).
+                    Matrix<Real> I_cc_xyt = diffusion / e_dxy_j * internal::kronecker(M_cc, edge(e_phi_xy, e_phi_xy)) - inflow(M_cc, e_phi_t, e_phi_t, e_phi_xy, e_phi_xy, negative_n);
 
-                                            b_cc_xyt -= negative * weights1t_j(kt) * e_weights2_j(kxy) * phi_t(kt, ht) * e_phi_xy(kxy, hxy) * phi_t(kt, jt) * e_phi_xy(kxy, jxy) * convection_n;
-
-                                            // J(*, *).
-
-                                            J_cc_xyt += weights1t_j(kt) * e_weights2_j(kxy) / e_dxy_j * phi_t(kt, ht) * e_phi_xy(kxy, hxy) * phi_t(kt, jt) * e_phi_xy(kxy, jxy) * diffusion;
-                                        }
-
-                                    I_a_cc_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy, I_a_cc_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy) + a_cc_xyt);
-                                    I_b_cc_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy, I_b_cc_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy) + b_cc_xyt);
-                                    I_J_cc_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy, I_J_cc_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy) + J_cc_xyt);
-                                }
+                    // a(*, *), diffusion.
+                    if(i < j)
+                        I_cc_xyt -= 0.5L * diffusion * internal::kronecker(M_cc, edge(e_phi_xy, e_gradn_phi_xy) - edge(e_gradn_phi_xy, e_phi_xy));
 
                     // CURRENT vs. NEIGHBOUR. Mind the indices.
 
-                    for(Natural jt = 0; jt < dofs_t; ++jt)
-                        for(Natural ht = 0; ht < n_dofs_t; ++ht)
-                            for(Natural jxy = 0; jxy < dofs_xy; ++jxy)
-                                for(Natural hxy = 0; hxy < n_dofs_xy; ++hxy) {
-                                    Real a_cn_xyt = 0.0L;
-                                    Real b_cn_xyt = 0.0L;
-                                    Real J_cn_xyt = 0.0L;
+                    // b(*, *), convection, and J(*, *).
+                    Matrix<Real> I_cn_xyt = inflow(M_cn, e_phi_t, n_phi_t, e_phi_xy, n_e_phi_xy, negative_n) - diffusion / e_dxy_j * internal::kronecker(M_cn, edge(e_phi_xy, n_e_phi_xy));
 
-                                    for(Natural kt = 0; kt < phi_t.rows(); ++kt)
-                                        for(Natural kxy = 0; kxy < e_phi_xy.rows(); ++kxy) { // Brute-force integral.
-                                            Real x = e_nodes2x_j(kxy);
-                                            Real y = e_nodes2y_j(kxy);
-                                            Real t = nodes1t_j(kt);
+                    // a(*, *), diffusion.
+                    if(i < j)
+                        I_cn_xyt -= 0.5L * diffusion * internal::kronecker(M_cn, edge(e_phi_xy, n_e_gradn_phi_xy) + edge(e_gradn_phi_xy, n_e_phi_xy));
 
-                                            // Equation coefficients.
-                                            auto [convection_x, convection_y] = equation.convection(x, y, t);
-                                            Real convection_n = normal(0) * convection_x + normal(1) * convection_y;
-                                            Real diffusion = equation.diffusion();
+                    // NEIGHBOUR vs. CURRENT. Mind the indices.
 
-                                            // Boundary check.
-                                            Real negative = (convection_n < 0.0L) ? 1.0L : 0.0L;
+                    // J(*, *).
+                    Matrix<Real> I_nc_xyt = -diffusion / e_dxy_j * internal::kronecker(M_nc, edge(n_e_phi_xy, e_phi_xy));
 
-                                            // a(*, *), diffusion.
+                    // a(*, *), diffusion.
+                    if(i < j)
+                        I_nc_xyt += 0.5L * diffusion * internal::kronecker(M_nc, edge(n_e_phi_xy, e_gradn_phi_xy) + edge(n_e_gradn_phi_xy, e_phi_xy));
 
-                                            if(i < j)
-                                                a_cn_xyt -= weights1t_j(kt) * e_weights2_j(kxy) * (0.5L * n_phi_t(kt, ht) * n_e_gradn_phi_xy(kxy, hxy) * phi_t(kt, jt) * e_phi_xy(kxy, jxy) - 0.5L * phi_t(kt, jt) * e_gradn_phi_xy(kxy, jxy) * (-n_phi_t(kt, ht) * n_e_phi_xy(kxy, hxy))) * diffusion;
+                    // NEIGHBOUR vs. NEIGHBOUR.
 
-                                            // b(*, *), convection.
+                    // J(*, *).
+                    Matrix<Real> I_nn_xyt = diffusion / e_dxy_j * internal::kronecker(M_nn, edge(n_e_phi_xy, n_e_phi_xy));
 
-                                            b_cn_xyt += negative * weights1t_j(kt) * e_weights2_j(kxy) * n_phi_t(kt, ht) * n_e_phi_xy(kxy, hxy) * phi_t(kt, jt) * e_phi_xy(kxy, jxy) * convection_n;
+                    // a(*, *), diffusion.
+                    if(i < j)
+                        I_nn_xyt += 0.5L * diffusion * internal::kronecker(M_nn, edge(n_e_phi_xy, n_e_gradn_phi_xy) - edge(n_e_gradn_phi_xy, n_e_phi_xy));
 
-                                            // J(*, *).
+                    // FACE INTEGRALS - PREBUILDING.
 
-                                            J_cn_xyt -= weights1t_j(kt) * e_weights2_j(kxy) / e_dxy_j * n_phi_t(kt, ht) * n_e_phi_xy(kxy, hxy) * phi_t(kt, jt) * e_phi_xy(kxy, jxy) * diffusion;
-                                        }
+                    I_cc.emplace_back(I_cc_xyt);
+                    I_cn.emplace_back(I_cn_xyt);
+                    I_nc.emplace_back(I_nc_xyt);
+                    I_nn.emplace_back(I_nn_xyt);
 
-                                    I_a_cn_xyt(jt * dofs_xy + jxy, ht * n_dofs_xy + hxy, I_a_cn_xyt(jt * dofs_xy + jxy, ht * n_dofs_xy + hxy) + a_cn_xyt);
-                                    I_b_cn_xyt(jt * dofs_xy + jxy, ht * n_dofs_xy + hxy, I_b_cn_xyt(jt * dofs_xy + jxy, ht * n_dofs_xy + hxy) + b_cn_xyt);
-                                    I_J_cn_xyt(jt * dofs_xy + jxy, ht * n_dofs_xy + hxy, I_J_cn_xyt(jt * dofs_xy + jxy, ht * n_dofs_xy + hxy) + J_cn_xyt);
-                                }
+                } else {
 
-                    // NEIGHBOUR vs. CURRENT. Mind the indices.
+                    // FACE INTEGRALS - COMPUTING.
 
-                    for(Natural jt = 0; jt < n_dofs_t; ++jt)
-                        for(Natural ht = 0; ht < dofs_t; ++ht)
-                            for(Natural jxy = 0; jxy < n_dofs_xy; ++jxy)
-                                for(Natural hxy = 0; hxy < dofs_xy; ++hxy) {
-                                    Real a_nc_xyt = 0.0L;
-                                    Real b_nc_xyt = 0.0L;
-                                    Real J_nc_xyt = 0.0L;
+                    // b(*, *), convection, and J(*, *).
+                    Matrix<Real> I_cc_xyt = diffusion / e_dxy_j * inflow(M_cc, e_phi_t, e_phi_t, e_phi_xy, e_phi_xy, negative) - inflow(M_cc, e_phi_t, e_phi_t, e_phi_xy, e_phi_xy, negative_n);
 
-                                    for(Natural kt = 0; kt < phi_t.rows(); ++kt)
-                                        for(Natural kxy = 0; kxy < e_phi_xy.rows(); ++kxy) { // Brute-force integral.
+                    // a(*, *), diffusion.
+                    I_cc_xyt -= diffusion * (inflow(M_cc, e_phi_t, e_phi_t, e_phi_xy, e_gradn_phi_xy, negative) - inflow(M_cc, e_phi_t, e_phi_t, e_gradn_phi_xy, e_phi_xy, negative));
 
-                                            // Equation coefficients.
-                                            Real diffusion = equation.diffusion();
+                    // FACE INTEGRALS - PREBUILDING.
 
-                                            // a(*, *), diffusion.
+                    I_cc.emplace_back(I_cc_xyt);
+                    I_cn.emplace_back(Matrix<Real>{1, 1});
+                    I_nc.emplace_back(Matrix<Real>{1, 1});
+                    I_nn.emplace_back(Matrix<Real>{1, 1});
+                }
+            }
 
-                                            if(i < j)
-                                                a_nc_xyt -= weights1t_j(kt) * e_weights2_j(kxy) * (0.5L * phi_t(kt, ht) * e_gradn_phi_xy(kxy, hxy) * (-n_phi_t(kt, jt) * n_e_phi_xy(kxy, jxy)) - 0.5L * n_phi_t(kt, jt) * n_e_gradn_phi_xy(kxy, jxy) * phi_t(kt, ht) * e_phi_xy(kxy, hxy)) * diffusion;
+            // FACE INTEGRALS - BUILDING.
 
-                                            // J(*, *).
+            for(Natural k = 0; k < neighbours; ++k) {
+                if(facing[k][0] != -1) {
 
-                                            J_nc_xyt -= weights1t_j(kt) * e_weights2_j(kxy) / e_dxy_j * phi_t(kt, ht) * e_phi_xy(kxy, hxy) * n_phi_t(kt, jt) * n_e_phi_xy(kxy, jxy) * diffusion;
-                                        }
+                    // Neighbour dofs.
+                    std::vector<Natural> n_dofs_j = mesh.dofs(facing[k][0]);
 
-                                    I_a_nc_xyt(jt * n_dofs_xy + jxy, ht * dofs_xy + hxy, I_a_nc_xyt(jt * n_dofs_xy + jxy, ht * dofs_xy + hxy) + a_nc_xyt);
-                                    I_b_nc_xyt(jt * n_dofs_xy + jxy, ht * dofs_xy + hxy, I_b_nc_xyt(jt * n_dofs_xy + jxy, ht * dofs_xy + hxy) + b_nc_xyt);
-                                    I_J_nc_xyt(jt * n_dofs_xy + jxy, ht * dofs_xy + hxy, I_J_nc_xyt(jt * n_dofs_xy + jxy, ht * dofs_xy + hxy) + J_nc_xyt);
-                                }
+                    // Building.
+                    I(dofs_j, dofs_j, I(dofs_j, dofs_j) + I_cc[k]);
+                    I(dofs_j, n_dofs_j, I(dofs_j, n_dofs_j) + I_cn[k]);
+                    I(n_dofs_j, dofs_j, I(n_dofs_j, dofs_j) + I_nc[k]);
+                    I(n_dofs_j, n_dofs_j, I(n_dofs_j, n_dofs_j) + I_nn[k]);
+                    
+                } else {
+                    
+                    // Building.
+                    I(dofs_j, dofs_j, I(dofs_j, dofs_j) + I_cc[k]);
+                }
+            }
 
-                    // NEIGHBOUR vs. NEIGHBOUR.
+            #ifndef NVERBOSE
+            if((j + 1) % mesh.space() == 0)
+                std::cout << "\t[Stiffness] Progress: " << j / mesh.space() + 1 << "/" << mesh.time() << std::endl;
+            #endif
+        }
 
-                    for(Natural jt = 0; jt < n_dofs_t; ++jt)
-                        for(Natural ht = 0; ht < n_dofs_t; ++ht)
-                            for(Natural jxy = 0; jxy < n_dofs_xy; ++jxy)
-                                for(Natural hxy = 0; hxy < n_dofs_xy; ++hxy) {
-                                    Real a_nn_xyt = 0.0L;
-                                    Real b_nn_xyt = 0.0L;
-                                    Real J_nn_xyt = 0.0L;
+        // Face integrals, time.
+        Sparse<Real> E = jump(mesh);
 
-                                    for(Natural kt = 0; kt < phi_t.rows(); ++kt)
-                                        for(Natural kxy = 0; kxy < e_phi_xy.rows(); ++kxy) { // Brute-force integral.
+        #ifndef NVERBOSE
+        std::cout << "\t[Stiffness] Exited" << std::endl;
+        #endif
 
-                                            // Equation coefficients.
-                                            Real diffusion = equation.diffusion();
+        // Building and return.
 
-                                            // a(*, *), diffusion.
+        return T + E + V + I;
+    }
 
-                                            if(i < j)
-                                                a_nn_xyt -= weights1t_j(kt) * e_weights2_j(kxy) * (0.5L * n_phi_t(kt, ht) * n_e_gradn_phi_xy(kxy, hxy) * (-n_phi_t(kt, jt) * n_e_phi_xy(kxy, jxy)) - 0.5L * n_phi_t(kt, jt) * n_e_gradn_phi_xy(kxy, jxy) * (-n_phi_t(kt, ht) * n_e_phi_xy(kxy, hxy))) * diffusion;
+    /**
+     * @brief Builds the time jumps' matrix, current vs. current.
+     * Part of the stiffness matrix.
+     * 
+     * @param mesh Mesh.
+     * @return Sparse<Real> 
+     */
+    Sparse<Real> jump(const Mesh21 &mesh) {
 
-                                            // J(*, *).
+        // Jumps matrix.
+        Sparse<Real> E{mesh.dofs(), mesh.dofs()}; // Face integrals, time.
 
-                                            J_nn_xyt += weights1t_j(kt) * e_weights2_j(kxy) / e_dxy_j * n_phi_t(kt, ht) * n_e_phi_xy(kxy, hxy) * n_phi_t(kt, jt) * n_e_phi_xy(kxy, jxy) * diffusion;
-                                        }
+        // Loop over elements.
+        for(Natural j = 0; j < mesh.space() * mesh.time(); ++j) {
 
-                                    I_a_nn_xyt(jt * n_dofs_xy + jxy, ht * n_dofs_xy + hxy, I_a_nn_xyt(jt * n_dofs_xy + jxy, ht * n_dofs_xy + hxy) + a_nn_xyt);
-                                    I_b_nn_xyt(jt * n_dofs_xy + jxy, ht * n_dofs_xy + hxy, I_b_nn_xyt(jt * n_dofs_xy + jxy, ht * n_dofs_xy + hxy) + b_nn_xyt);
-                                    I_J_nn_xyt(jt * n_dofs_xy + jxy, ht * n_dofs_xy + hxy, I_J_nn_xyt(jt * n_dofs_xy + jxy, ht * n_dofs_xy + hxy) + J_nn_xyt);
-                                }
+            // Element's temporaries, thread's arena.
+            internal::Scope scope;
 
-                    // FACE INTEGRALS - PREBUILDING.
+            // ELEMENT DATA.
 
-                    I_cc.emplace_back(I_a_cc_xyt + I_b_cc_xyt + I_J_cc_xyt);
-                    I_cn.emplace_back(I_a_cn_xyt + I_b_cn_xyt + I_J_cn_xyt);
-                    I_nc.emplace_back(I_a_nc_xyt + I_b_nc_xyt + I_J_nc_xyt);
-                    I_nn.emplace_back(I_a_nn_xyt + I_b_nn_xyt + I_J_nn_xyt);
+            // Element.
+            const Element21 &element = mesh.element(j);
 
-                } else {
+            // Dofs.
+            std::vector<Natural> dofs_j = mesh.dofs(j);
 
-                    // FACE INTEGRALS - COMPUTING.
+            // TIME FACE INTEGRALS - PRECOMPUTING.
 
-                    for(Natural jt = 0; jt < dofs_t; ++jt)
-                        for(Natural ht = 0; ht < dofs_t; ++ht)
-                            for(Natural jxy = 0; jxy < dofs_xy; ++jxy)
-                                for(Natural hxy = 0; hxy < dofs_xy; ++hxy) {
-                                    Real a_cc_xyt = 0.0L;
-                                    Real b_cc_xyt = 0.0L;
-                                    Real J_cc_xyt = 0.0L;
+            // Reference time jump, (*(-1), *(-1)).
+            const Matrix<Real> &J_t = internal::time_matrices(element.q())[2];
 
-                                    for(Natural kt = 0; kt < phi_t.rows(); ++kt)
-                                        for(Natural kxy = 0; kxy < e_phi_xy.rows(); ++kxy) { // Brute-force integral.
-                                            Real x = e_nodes2x_j(kxy);
-                                            Real y = e_nodes2y_j(kxy);
-                                            Real t = nodes1t_j(kt);
+            // TIME FACE INTEGRALS - COMPUTING.
 
-                                            // Equation coefficients.
-                                            auto [convection_x, convection_y] = equation.convection(x, y, t);
-                                            Real convection_n = normal(0) * convection_x + normal(1) * convection_y;
-                                            Real diffusion = equation.diffusion();
+            // Monomial coefficients and moments, exact.
+            auto [phi_xy, gradx_phi_xy, grady_phi_xy] = internal::monomials_xy(mesh, j);
+            const Matrix<Real> moments = internal::moments_xy(mesh, j, 2 * element.p());
 
-                                            // Boundary check.
-                                            Real negative = (convection_n < 0.0L) ? 1.0L : 0.0L;
+            // CURRENT vs. CURRENT.
 
-                                            // a(*, *), diffusion.
+            Matrix<Real> E_cc_xyt = internal::kronecker(J_t, internal::exact_xy(moments, phi_xy, phi_xy));
 
-                                            a_cc_xyt -= negative * weights1t_j(kt) * e_weights2_j(kxy) * (phi_t(kt, ht) * e_gradn_phi_xy(kxy, hxy) * phi_t(kt, jt) * e_phi_xy(kxy, jxy) - phi_t(kt, jt) * e_gradn_phi_xy(kxy, jxy) * phi_t(kt, ht) * e_phi_xy(kxy, hxy)) * diffusion;
+            // TIME FACE INTEGRALS - BUILDING.
 
-                                            // b(*, *), convection.
+            E(dofs_j, dofs_j, E(dofs_j, dofs_j) + E_cc_xyt);
+        }
 
-                                            b_cc_xyt -= negative * weights1t_j(kt) * e_weights2_j(kxy) * phi_t(kt, ht) * e_phi_xy(kxy, hxy) * phi_t(kt, jt) * e_phi_xy(kxy, jxy) * convection_n;
+        return E;
+    }
 
-                                            // J(*, *).
+    /**
+     * @brief Builds the time slabs' coupling matrix, upwind time jump.
+     * A time slab's right-hand side reads b_j - C x_{j - 1}.
+     * 
+     * @param mesh Mesh.
+     * @return Sparse<Real> 
+     */
+    Sparse<Real> coupling(const Mesh21 &mesh) {
 
-                                            J_cc_xyt += negative * weights1t_j(kt) * e_weights2_j(kxy) / e_dxy_j * phi_t(kt, ht) * e_phi_xy(kxy, hxy) * phi_t(kt, jt) * e_phi_xy(kxy, jxy) * diffusion;
-                                        }
+        // Coupling matrix.
+        Sparse<Real> C{mesh.dofs(), mesh.dofs()};
 
-                                    I_a_cc_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy, I_a_cc_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy) + a_cc_xyt);
-                                    I_b_cc_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy, I_b_cc_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy) + b_cc_xyt);
-                                    I_J_cc_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy, I_J_cc_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy) + J_cc_xyt);
-                                }
+        #ifndef NVERBOSE
+        std::cout << "[Ivo] Coupling" << std::endl;
+        std::cout << "\t[Coupling] Building the coupling matrix" << std::endl;
+        #endif
 
-                    // FACE INTEGRALS - PREBUILDING.
+        // Loop over elements, first time slab excluded.
+        for(Natural j = mesh.space(); j < mesh.space() * mesh.time(); ++j) {
 
-                    I_cc.emplace_back(I_a_cc_xyt + I_b_cc_xyt + I_J_cc_xyt);
-                    I_cn.emplace_back(Matrix<Real>{1, 1});
-                    I_nc.emplace_back(Matrix<Real>{1, 1});
-                    I_nn.emplace_back(Matrix<Real>{1, 1});
-                }
-            }
+            // Element's temporaries, thread's arena.
+            internal::Scope scope;
 
-            // FACE INTEGRALS - BUILDING.
+            // ELEMENT DATA.
 
-            for(Natural k = 0; k < neighbours; ++k) {
-                if(facing[k][0] != -1) {
+            // Element and past element.
+            const Element21 &element = mesh.element(j);
+            const Element21 &n_element = mesh.element(j - mesh.space());
 
-                    // Neighbour dofs.
-                    std::vector<Natural> n_dofs_j = mesh.dofs(facing[k][0]);
+            // Dofs.
+            std::vector<Natural> dofs_j = mesh.dofs(j);
+            Natural dofs_xy = (element.p() + 1) * (element.p() + 2) / 2;
+            Natural dofs_t = element.q() + 1;
 
-                    // Building.
-                    I(dofs_j, dofs_j, I(dofs_j, dofs_j) + I_cc[k]);
-                    I(dofs_j, n_dofs_j, I(dofs_j, n_dofs_j) + I_cn[k]);
-                    I(n_dofs_j, dofs_j, I(n_dofs_j, dofs_j) + I_nc[k]);
-                    I(n_dofs_j, n_dofs_j, I(n_dofs_j, n_dofs_j) + I_nn[k]);
-                    
-                } else {
-                    
-                    // Building.
-                    I(dofs_j, dofs_j, I(dofs_j, dofs_j) + I_cc[k]);
-                }
-            }
+            std::vector<Natural> n_dofs_j = mesh.dofs(j - mesh.space());
+            Natural n_dofs_xy = (n_element.p() + 1) * (n_element.p() + 2) / 2;
+            Natural n_dofs_t = n_element.q() + 1;
 
             // TIME FACE INTEGRALS - PRECOMPUTING.
 
-            // Face time basis.
-            auto [f_phi_t, f_gradt_phi_t] = basis_t(mesh, j, Vector<Real>{1, interval[0]});
+            // Reference time traces, current at -1 and past at 1.
+            const Vector<Real> &f_phi_t = internal::time_traces(element.q())[0];
+            const Vector<Real> &n_f_phi_t = internal::time_traces(n_element.q())[1];
 
             // Submatrix.
-            Matrix<Real> E_cc_xyt{dofs_xyt, dofs_xyt};
+            Matrix<Real> C_cn_xyt{dofs_t * dofs_xy, n_dofs_t * n_dofs_xy};
 
             // TIME FACE INTEGRALS - COMPUTING.
 
-            for(Natural k = 0; k < neighbours; ++k) { // Sub-triangulation.
+            // Monomial coefficients and moments, exact, shared cell.
+            auto [phi_xy, gradx_phi_xy, grady_phi_xy] = internal::monomials_xy(mesh, j);
+            auto [n_phi_xy, n_gradx_phi_xy, n_grady_phi_xy] = internal::monomials_xy(mesh, j - mesh.space());
+            const Matrix<Real> moments = internal::moments_xy(mesh, j, element.p() + n_element.p());
 
-                // Nodes and basis.
-                auto [nodes2xy_j, dxy_j] = internal::reference_to_element(mesh, j, k, {nodes2x, nodes2y});
-                auto [phi_xy, gradx_phi_xy, grady_phi_xy] = basis_xy(mesh, j, nodes2xy_j);
+            // CURRENT vs. PAST, space.
 
-                // Weights, space.
-                Vector<Real> weights2_j = weights2 * dxy_j;
-
-                // CURRENT vs. CURRENT.
+            Matrix<Real> C_xy = internal::exact_xy(moments, phi_xy, n_phi_xy);
 
-                for(Natural jt = 0; jt < dofs_t; ++jt)
-                    for(Natural ht = 0; ht < dofs_t; ++ht)
-                        for(Natural jxy = 0; jxy < dofs_xy; ++jxy)
-                            for(Natural hxy = 0; hxy < dofs_xy; ++hxy) {
-                                Real cc_xyt = 0.0L;
+            // CURRENT vs. PAST.
 
-                                for(Natural kxy = 0; kxy < phi_xy.rows(); ++kxy) // Brute-force integral, (*, *).
-                                    cc_xyt += weights2_j(kxy) * f_phi_t(0, ht) * phi_xy(kxy, hxy) * f_phi_t(0, jt) * phi_xy(kxy, jxy);
-                            
-                                E_cc_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy, E_cc_xyt(jt * dofs_xy + jxy, ht * dofs_xy + hxy) + cc_xyt);
-                            }
-            }
+            for(Natural jt = 0; jt < dofs_t; ++jt)
+                for(Natural nt = 0; nt < n_dofs_t; ++nt)
+                    for(Natural jxy = 0; jxy < dofs_xy; ++jxy)
+                        for(Natural nxy = 0; nxy < n_dofs_xy; ++nxy)
+                            C_cn_xyt(jt * dofs_xy + jxy, nt * n_dofs_xy + nxy, -f_phi_t(jt) * n_f_phi_t(nt) * C_xy(jxy, nxy));
 
             // TIME FACE INTEGRALS - BUILDING.
 
-            E(dofs_j, dofs_j, E(dofs_j, dofs_j) + E_cc_xyt);
+            C(dofs_j, n_dofs_j, C_cn_xyt);
 
             #ifndef NVERBOSE
             if((j + 1) % mesh.space() == 0)
-                std::cout << "\t[Stiffness] Progress: " << j / mesh.space() + 1 << "/" << mesh.time() << std::endl;
+                std::cout << "\t[Coupling] Progress: " << j / mesh.space() + 1 << "/" << mesh.time() << std::endl;
             #endif
         }
 
         #ifndef NVERBOSE
-        std::cout << "\t[Stiffness] Exited" << std::endl;
+        std::cout << "\t[Coupling] Exited" << std::endl;
         #endif
 
-        // Building and return.
-
-        return T + E + V + I;
+        return C;
     }
 
 }
\ No newline at end of file
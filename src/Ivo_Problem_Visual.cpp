@@ -22,8 +22,8 @@ namespace ivo {
     void visual(const Mesh21 &mesh, const Vector<Real> &solution, const std::string &filename) {
 
         // Quadrature, visualization only.
-        auto [nodes1t, weights1t] = quadrature1t(3);
-        auto [nodes2x, nodes2y, weights2] = quadrature2xy(3);
+        const auto &[nodes1t, weights1t] = quadrature1t(3);
+        const auto &[nodes2x, nodes2y, weights2] = quadrature2xy(3);
 
         // Output.
         std::ofstream output(filename);
@@ -36,19 +36,17 @@ namespace ivo {
         // Loop over elements.
         for(Natural j = 0; j < mesh.space() * mesh.time(); ++j) {
 
-            // Element.
-            Element21 element = mesh.element(j);
+            // Element's temporaries, thread's arena.
+            internal::Scope scope;
 
             // Neighbours.
-            Neighbour21 neighbourhood = mesh.neighbour(j);
+            const Neighbour21 &neighbourhood = mesh.neighbour(j);
 
             std::vector<std::array<Integer, 2>> facing = neighbourhood.facing();
             Natural neighbours = facing.size();
 
             // Dofs.
             std::vector<Natural> dofs_j = mesh.dofs(j);
-            Natural dofs_xy = (element.p() + 1) * (element.p() + 2) / 2;
-            Natural dofs_t = element.q() + 1;
 
             // Nodes and basis.
             auto [nodes1t_j, dt_j] = internal::reference_to_element(mesh, j, nodes1t);
@@ -63,21 +61,15 @@ namespace ivo {
 
                 // Local solution.
                 Vector<Real> uh_j = solution(dofs_j);
+                Matrix<Real> uh_s = internal::evaluated(phi_t, phi_s, uh_j);
 
                 for(Natural kt = 0; kt < phi_t.rows(); ++kt)
-                    for(Natural kxy = 0; kxy < phi_s.rows(); ++kxy) { // Brute-force integral.
+                    for(Natural kxy = 0; kxy < phi_s.rows(); ++kxy) {
                         Real x = nodes2x_j(kxy);
                         Real y = nodes2y_j(kxy);
                         Real t = nodes1t_j(kt);
 
-                        Real uh = 0.0L;
-
-                        for(Natural jt = 0; jt < dofs_t; ++jt)
-                            for(Natural jxy = 0; jxy < dofs_xy; ++jxy)
-                                uh += phi_t(kt, jt) * phi_s(kxy, jxy) * uh_j(jt * dofs_xy + jxy);
-
-
-                        output << x << "," << y << "," << t << "," << uh << std::endl;
+                        output << x << "," << y << "," << t << "," << uh_s(kt, kxy) << std::endl;
                     }
             }
 
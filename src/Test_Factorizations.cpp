@@ -0,0 +1,113 @@
+/**
+ * @file Test_Factorizations.cpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Dense factorizations test.
+ * @date 2024-11-08
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "./include/Test.hpp"
+
+#include <Ivo.hpp>
+
+int main() {
+
+    std::cout << "[Ivo] TEST, Testing dense factorizations" << std::endl;
+
+    ivo::Natural failures = 0;
+
+    // Checks in every build.
+    auto check = [&failures](const bool &condition, const std::string &message) {
+        if(!condition) {
+            std::cout << "\t[Factorizations] Failed: " << message << std::endl;
+            ++failures;
+        }
+    };
+
+    // Residual's largest entry, |AX - B|.
+    auto residual = [](const ivo::Matrix<ivo::Real> &A, const ivo::Matrix<ivo::Real> &X, const ivo::Matrix<ivo::Real> &B) {
+        const ivo::Matrix<ivo::Real> R = A * X - B;
+        ivo::Real largest = 0.0L;
+
+        for(const auto &entry: R.data())
+            largest = std::max(largest, std::abs(entry));
+
+        return largest;
+    };
+
+    // Pivoting-sensitive matrix, tiny leading pivot.
+    ivo::Matrix<ivo::Real> A{4, 4, {
+        1E-20L, 1.0L, 2.0L, 0.0L,
+        1.0L, 1.0L, 0.0L, 3.0L,
+        2.0L, 3.0L, 1.0L, 1.0L,
+        0.0L, 4.0L, 1.0L, 2.0L
+    }};
+
+    // Symmetric positive definite matrix, A^T A + I.
+    ivo::Matrix<ivo::Real> S = A.transpose() * A;
+
+    for(ivo::Natural j = 0; j < 4; ++j)
+        S(j, j, S(j, j) + 1.0L);
+
+    // Right-hand sides.
+    ivo::Matrix<ivo::Real> B{4, 2, {
+        1.0L, 0.0L,
+        2.0L, -1.0L,
+        0.0L, 3.0L,
+        -1.0L, 1.0L
+    }};
+
+    const ivo::Vector<ivo::Real> b = B.column(0);
+
+    // LU, single and multiple right-hand sides.
+    const ivo::LU<ivo::Real> lu{A};
+    const ivo::Matrix<ivo::Real> X_lu = lu.solve(B);
+
+    check(residual(A, ivo::Matrix<ivo::Real>{4, 1, lu.solve(b)}, ivo::Matrix<ivo::Real>{4, 1, b}) < 1E-15L, "LU residual");
+    check(residual(A, X_lu, B) < 1E-15L, "LU residual, multiple right-hand sides");
+    check(ivo::norm(X_lu.column(0) - lu.solve(b)) < 1E-15L, "LU multiple right-hand sides, first column");
+
+    // Cholesky.
+    const ivo::Cholesky<ivo::Real> cholesky{S};
+
+    check(residual(S, cholesky.solve(B), B) < 1E-15L, "Cholesky residual");
+    check(residual(cholesky.factor(), cholesky.factor().transpose(), S) < 1E-15L, "Cholesky factor");
+
+    // QR, square and overdetermined.
+    const ivo::QR<ivo::Real> qr{A};
+
+    check(residual(A, qr.solve(B), B) < 1E-15L, "QR residual");
+
+    ivo::Matrix<ivo::Real> T{5, 2, {
+        1.0L, 0.0L,
+        1.0L, 1.0L,
+        1.0L, 2.0L,
+        1.0L, 3.0L,
+        1.0L, 4.0L
+    }};
+
+    ivo::Vector<ivo::Real> t{5};
+
+    for(ivo::Natural j = 0; j < 5; ++j)
+        t(j, 2.0L + 0.5L * j + ((j % 2 == 0) ? 0.1L : -0.1L));
+
+    // Normal equations, T^T (Tx - t) = 0.
+    const ivo::Vector<ivo::Real> x_qr = qr.solve(b);
+    const ivo::Vector<ivo::Real> x_ls = ivo::QR<ivo::Real>{T}.solve(t);
+
+    check(ivo::norm(A * x_qr - b) < 1E-15L, "QR solution");
+    check(ivo::norm(T.transpose() * (T * x_ls - t)) < 1E-15L, "QR least squares");
+
+    // Batched.
+    const std::vector<ivo::LU<ivo::Real>> factors = ivo::factorize<ivo::LU>(std::vector<ivo::Matrix<ivo::Real>>{A, S});
+    const std::vector<ivo::Vector<ivo::Real>> solutions = ivo::solve(factors, std::vector<ivo::Vector<ivo::Real>>{b, b});
+
+    check(ivo::norm(A * solutions[0] - b) < 1E-15L, "Batched LU, first block");
+    check(ivo::norm(S * solutions[1] - b) < 1E-15L, "Batched LU, second block");
+
+    std::cout << "\t[Factorizations] " << ((failures == 0) ? "Passed" : "Failed") << std::endl;
+
+    return (failures == 0) ? 0 : -1;
+}
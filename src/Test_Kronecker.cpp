@@ -0,0 +1,82 @@
+/**
+ * @file Test_Kronecker.cpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Implicit Kronecker products test.
+ * @date 2024-11-08
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "./include/Test.hpp"
+
+#include <Ivo.hpp>
+
+int main() {
+
+    std::cout << "[Ivo] TEST, Testing implicit Kronecker products" << std::endl;
+
+    ivo::Natural failures = 0;
+
+    // Checks in every build.
+    auto check = [&failures](const bool &condition, const std::string &message) {
+        if(!condition) {
+            std::cout << "\t[Kronecker] Failed: " << message << std::endl;
+            ++failures;
+        }
+    };
+
+    // Distance between products.
+    auto distance = [](const ivo::Vector<ivo::Real> &x, const ivo::Vector<ivo::Real> &y) {
+        return (x.size() == y.size()) ? ivo::norm(x - y) : 1.0L;
+    };
+
+    // Rectangular factors, X: 2 x 3, Y: 3 x 2.
+    ivo::Matrix<ivo::Real> X{2, 3};
+    ivo::Matrix<ivo::Real> Y{3, 2};
+
+    for(ivo::Natural j = 0; j < 2; ++j)
+        for(ivo::Natural k = 0; k < 3; ++k) {
+            X(j, k, static_cast<ivo::Real>(j + 2 * k + 1));
+            Y(k, j, (k == j) ? 0.0L : static_cast<ivo::Real>(3 * k - j + 1));
+        }
+
+    // CSR factors.
+    ivo::Sparse<ivo::Real> X_s{2, 3};
+    ivo::Sparse<ivo::Real> Y_s{3, 2};
+
+    for(ivo::Natural j = 0; j < 2; ++j)
+        for(ivo::Natural k = 0; k < 3; ++k) {
+            X_s(j, k, X(j, k));
+            Y_s(k, j, Y(k, j));
+        }
+
+    // Vector.
+    ivo::Vector<ivo::Real> v{6};
+
+    for(ivo::Natural j = 0; j < 6; ++j)
+        v(j, static_cast<ivo::Real>(j % 4) - 1.5L);
+
+    // Explicit product.
+    const ivo::Vector<ivo::Real> XYv = ivo::kronecker(X, Y) * v;
+
+    // Dense, sparse-dense, dense-sparse and sparse factors.
+    check(distance(ivo::Kronecker<ivo::Real>{X, Y} * v, XYv) < 1E-14L, "Dense factors");
+    check(distance(ivo::Kronecker<ivo::Real>{X_s, Y} * v, XYv) < 1E-14L, "Sparse-dense factors");
+    check(distance(ivo::Kronecker<ivo::Real>{X, Y_s} * v, XYv) < 1E-14L, "Dense-sparse factors");
+    check(distance(ivo::Kronecker<ivo::Real>{X_s, Y_s} * v, XYv) < 1E-14L, "Sparse factors");
+
+    // Coefficient.
+    check(distance((2.0L * ivo::Kronecker<ivo::Real>{X, Y_s}) * v, 2.0L * XYv) < 1E-14L, "Coefficient");
+
+    // Sums, self-addition included.
+    ivo::Kroneckers<ivo::Real> K = ivo::Kronecker<ivo::Real>{X, Y} + ivo::Kronecker<ivo::Real>{X_s, Y_s};
+    K += K;
+
+    check(K.terms() == 4, "Self-addition, terms");
+    check(distance(K * v, 4.0L * XYv) < 1E-13L, "Self-addition, product");
+
+    std::cout << "\t[Kronecker] " << ((failures == 0) ? "Passed" : "Failed") << std::endl;
+
+    return (failures == 0) ? 0 : -1;
+}
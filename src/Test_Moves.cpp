@@ -0,0 +1,88 @@
+/**
+ * @file Test_Moves.cpp
+ * @author Andrea Di Antonio (github.com/diantonioandrea)
+ * @brief Vector and Matrix move semantics test.
+ * @date 2024-11-06
+ * 
+ * @copyright Copyright (c) 2024
+ * 
+ */
+
+#include "./include/Test.hpp"
+
+#include <Ivo.hpp>
+
+int main() {
+
+    std::cout << "[Ivo] TEST, Testing Vector and Matrix moves" << std::endl;
+
+    ivo::Natural failures = 0;
+
+    // Checks in every build.
+    auto check = [&failures](const bool &condition, const std::string &message) {
+        if(!condition) {
+            std::cout << "\t[Moves] Failed: " << message << std::endl;
+            ++failures;
+        }
+    };
+
+    // Vector swap.
+    ivo::Vector<ivo::Real> a{3, 1.0L};
+    ivo::Vector<ivo::Real> b{3, 2.0L};
+
+    std::swap(a, b);
+    check((a.size() == 3) && (a(0) == 2.0L) && (b.size() == 3) && (b(2) == 1.0L), "Vector swap");
+
+    // Vector swap, different sizes.
+    ivo::Vector<ivo::Real> c{5, 3.0L};
+
+    std::swap(a, c);
+    check((a.size() == 5) && (a(4) == 3.0L) && (c.size() == 3) && (c(0) == 2.0L), "Vector swap, different sizes");
+
+    // Moved-from vector, reassigned.
+    ivo::Vector<ivo::Real> d{std::move(a)};
+    check((d.size() == 5) && (a.size() == 0) && a.data().empty(), "Vector move, empty source");
+
+    a = ivo::Vector<ivo::Real>{2, 4.0L};
+    check((a.size() == 2) && (a(1) == 4.0L), "Vector reassignment");
+
+    // Algorithm-driven moves.
+    std::vector<ivo::Vector<ivo::Real>> vectors;
+
+    for(ivo::Natural j = 1; j < 5; ++j)
+        vectors.emplace_back(j, static_cast<ivo::Real>(j));
+
+    std::reverse(vectors.begin(), vectors.end());
+
+    for(ivo::Natural j = 0; j < 4; ++j)
+        check((vectors[j].size() == 4 - j) && (vectors[j](0) == static_cast<ivo::Real>(4 - j)), "Vector reverse");
+
+    // Matrix swap, different shapes.
+    ivo::Matrix<ivo::Real> A{2, 2, 1.0L};
+    ivo::Matrix<ivo::Real> B{3, 1, 2.0L};
+
+    std::swap(A, B);
+    check((A.rows() == 3) && (A.columns() == 1) && (A(2, 0) == 2.0L) && (B.rows() == 2) && (B(1, 1) == 1.0L), "Matrix swap");
+
+    // Moved-from matrix, reassigned.
+    ivo::Matrix<ivo::Real> C{std::move(A)};
+    check((C.rows() == 3) && (A.rows() == 0) && A.data().empty(), "Matrix move, empty source");
+
+    A = ivo::Matrix<ivo::Real>{1, 2, 5.0L};
+    check((A.rows() == 1) && (A.columns() == 2) && (A(0, 1) == 5.0L), "Matrix reassignment");
+
+    // Algorithm-driven moves.
+    std::vector<ivo::Matrix<ivo::Real>> matrices;
+
+    for(ivo::Natural j = 1; j < 5; ++j)
+        matrices.emplace_back(j, j + 1, static_cast<ivo::Real>(j));
+
+    std::reverse(matrices.begin(), matrices.end());
+
+    for(ivo::Natural j = 0; j < 4; ++j)
+        check((matrices[j].rows() == 4 - j) && (matrices[j].columns() == 5 - j) && (matrices[j](0, 0) == static_cast<ivo::Real>(4 - j)), "Matrix reverse");
+
+    std::cout << "\t[Moves] " << ((failures == 0) ? "Passed" : "Failed") << std::endl;
+
+    return (failures == 0) ? 0 : -1;
+}
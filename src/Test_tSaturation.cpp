@@ -34,7 +34,7 @@ int main(int argc, char **argv) {
     #endif
 
     // Equation.
-    const ivo::Equation equation{ivo::square::convection, ivo::square::diffusion, ivo::square::reaction};
+    const ivo::Equation equation{ivo::square::convection, ivo::square::diffusion, ivo::square::reaction, ivo::square::degree};
     const ivo::Initial initial{ivo::square::u0};
     const ivo::Data data{ivo::square::g, ivo::square::gd, ivo::square::gn};
 
@@ -45,7 +45,7 @@ int main(int argc, char **argv) {
     // diagrams.emplace_back("data/square/Square_8000.p2"); // Expensive.
 
     // Equation.
-    const ivo::Equation equation{ivo::square::convection, ivo::square::diffusion, ivo::square::reaction};
+    const ivo::Equation equation{ivo::square::convection, ivo::square::diffusion, ivo::square::reaction, ivo::square::degree};
     const ivo::Initial initial{ivo::square::u0};
     const ivo::Data data{ivo::square::g, ivo::square::gd, ivo::square::gn};
 
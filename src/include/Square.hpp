@@ -56,6 +56,12 @@ namespace ivo {
             return 0.5L;
         }
 
+        /**
+         * @brief Coefficients' polynomial degree, constant coefficients.
+         * 
+         */
+        const Natural degree = 0;
+
         /**
          * @brief Boundary layer coefficient.
          * 